@@ -0,0 +1,159 @@
+// ue5_local_client.h
+// UE5HTTPServerのローカル転送（Unixドメインソケット）用の最小クライアント（POSIX、ヘッダーのみ）
+//
+//   ue5::LocalClient Client("/tmp/ue5httpserver.sock");
+//   ue5::LocalResponse Response = Client.Request("GET", "/scene");
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace ue5
+{
+    struct LocalResponse
+    {
+        int Status = 0;
+        std::string Body;
+    };
+
+    class LocalClient
+    {
+    public:
+        explicit LocalClient(const std::string& SocketPath = "/tmp/ue5httpserver.sock")
+        {
+            sockaddr_un Address = {};
+            Address.sun_family = AF_UNIX;
+            if (SocketPath.size() >= sizeof(Address.sun_path))
+            {
+                throw std::runtime_error("socket path too long");
+            }
+            std::memcpy(Address.sun_path, SocketPath.data(), SocketPath.size());
+
+            Socket = socket(AF_UNIX, SOCK_STREAM, 0);
+            if (Socket < 0 || connect(Socket, reinterpret_cast<sockaddr*>(&Address), sizeof(Address)) != 0)
+            {
+                Close();
+                throw std::runtime_error("failed to connect to UE5 local transport");
+            }
+        }
+
+        ~LocalClient()
+        {
+            Close();
+        }
+
+        LocalClient(const LocalClient&) = delete;
+        LocalClient& operator=(const LocalClient&) = delete;
+
+        // 要求: [uint32 長さ][uint32 要求ID]["METHOD PATH\n"][本体]
+        // 1要求ずつ応答を待つ（続けて送る場合は応答の要求IDで対応を取る必要がある）
+        LocalResponse Request(const std::string& Method, const std::string& Path, const std::string& Body = std::string())
+        {
+            const uint32_t RequestId = NextRequestId++;
+            if (NextRequestId == 0)
+            {
+                NextRequestId = 1;
+            }
+
+            std::string Frame(8, '\0');
+            Frame += Method;
+            Frame += ' ';
+            Frame += Path;
+            Frame += '\n';
+            Frame += Body;
+
+            const uint32_t Length = static_cast<uint32_t>(Frame.size() - 4);
+            WriteLittleEndian(&Frame[0], Length, 4);
+            WriteLittleEndian(&Frame[4], RequestId, 4);
+            SendAll(Frame.data(), Frame.size());
+
+            // 応答: [uint32 長さ][uint32 要求ID][uint16 ステータス][本体]
+            char Header[10];
+            ReceiveAll(Header, sizeof(Header));
+            const uint32_t ResponseLength = ReadLittleEndian(Header, 4);
+            if (ResponseLength < 6)
+            {
+                throw std::runtime_error("malformed response");
+            }
+            if (ReadLittleEndian(Header + 4, 4) != RequestId)
+            {
+                throw std::runtime_error("unexpected response id");
+            }
+
+            LocalResponse Response;
+            Response.Status = static_cast<int>(ReadLittleEndian(Header + 8, 2));
+            Response.Body.resize(ResponseLength - 6);
+            if (!Response.Body.empty())
+            {
+                ReceiveAll(&Response.Body[0], Response.Body.size());
+            }
+            return Response;
+        }
+
+    private:
+        int Socket = -1;
+        uint32_t NextRequestId = 1;
+
+        void Close()
+        {
+            if (Socket >= 0)
+            {
+                close(Socket);
+                Socket = -1;
+            }
+        }
+
+        static void WriteLittleEndian(char* Out, uint32_t Value, int Bytes)
+        {
+            for (int Index = 0; Index < Bytes; ++Index)
+            {
+                Out[Index] = static_cast<char>((Value >> (8 * Index)) & 0xFF);
+            }
+        }
+
+        static uint32_t ReadLittleEndian(const char* In, int Bytes)
+        {
+            uint32_t Value = 0;
+            for (int Index = 0; Index < Bytes; ++Index)
+            {
+                Value |= static_cast<uint32_t>(static_cast<unsigned char>(In[Index])) << (8 * Index);
+            }
+            return Value;
+        }
+
+        void SendAll(const char* Data, size_t Size)
+        {
+            while (Size > 0)
+            {
+                const ssize_t Sent = send(Socket, Data, Size, 0);
+                if (Sent <= 0)
+                {
+                    throw std::runtime_error("send failed");
+                }
+                Data += Sent;
+                Size -= static_cast<size_t>(Sent);
+            }
+        }
+
+        void ReceiveAll(char* Data, size_t Size)
+        {
+            while (Size > 0)
+            {
+                const ssize_t Received = recv(Socket, Data, Size, 0);
+                if (Received <= 0)
+                {
+                    throw std::runtime_error("connection closed");
+                }
+                Data += Received;
+                Size -= static_cast<size_t>(Received);
+            }
+        }
+    };
+}
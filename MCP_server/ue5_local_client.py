@@ -0,0 +1,80 @@
+"""UE5HTTPServerのローカル転送（Unixドメインソケット）用の最小クライアント
+
+UE5側でコンソール変数 UE5HTTPServer.LocalSocketPath を設定すると有効になります。
+
+    client = UE5LocalClient("/tmp/ue5httpserver.sock")
+    status, body = client.request("PUT", "/actors/RedCube/location",
+                                  {"location": {"x": 0, "y": 0, "z": 100}})
+
+応答は完了した順に返るため、複数の要求を続けて送る場合は send() の戻り値の要求IDで receive() します。
+
+    scene_id = client.send("GET", "/scene")
+    health_id = client.send("GET", "/health")
+    status, body = client.receive(health_id)
+"""
+import json
+import socket
+import struct
+from typing import Any, Dict, Optional, Tuple
+
+DEFAULT_SOCKET_PATH = "/tmp/ue5httpserver.sock"
+
+
+class UE5LocalClient:
+    def __init__(self, socket_path: str = DEFAULT_SOCKET_PATH):
+        self.sock = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        self.sock.connect(socket_path)
+        self.next_request_id = 1
+        # 待っている要求より先に届いた応答
+        self.received: Dict[int, Tuple[int, Any]] = {}
+
+    def close(self):
+        self.sock.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.close()
+
+    def request(self, method: str, path: str, body: Optional[Any] = None) -> Tuple[int, Any]:
+        return self.receive(self.send(method, path, body))
+
+    def send(self, method: str, path: str, body: Optional[Any] = None) -> int:
+        # 要求: [uint32 長さ][uint32 要求ID]["METHOD PATH\n"][本体]
+        request_id = self.next_request_id
+        self.next_request_id = (self.next_request_id + 1) & 0xFFFFFFFF or 1
+        payload = struct.pack("<I", request_id) + f"{method} {path}\n".encode("utf-8")
+        if body is not None:
+            payload += json.dumps(body, separators=(",", ":")).encode("utf-8")
+        self.sock.sendall(struct.pack("<I", len(payload)) + payload)
+        return request_id
+
+    def receive(self, request_id: int) -> Tuple[int, Any]:
+        while request_id not in self.received:
+            # 応答: [uint32 長さ][uint32 要求ID][uint16 ステータス][本体]
+            (length,) = struct.unpack("<I", self._recv_exact(4))
+            frame = self._recv_exact(length)
+            response_id, status = struct.unpack("<IH", frame[:6])
+            data = frame[6:]
+            self.received[response_id] = (status, json.loads(data) if data else None)
+        return self.received.pop(request_id)
+
+    def _recv_exact(self, size: int) -> bytes:
+        chunks = bytearray()
+        while len(chunks) < size:
+            chunk = self.sock.recv(size - len(chunks))
+            if not chunk:
+                raise ConnectionError("UE5 local transport closed")
+            chunks.extend(chunk)
+        return bytes(chunks)
+
+
+if __name__ == "__main__":
+    import time
+
+    with UE5LocalClient() as client:
+        start = time.perf_counter()
+        status, body = client.request("GET", "/health")
+        elapsed = (time.perf_counter() - start) * 1e6
+        print(f"{status} {body} ({elapsed:.0f} us)")
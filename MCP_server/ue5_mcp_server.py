@@ -12,6 +12,13 @@ logging.basicConfig(level=logging.INFO)
 logger = logging.getLogger(__name__)
 
 UE5_BASE_URL = "http://localhost:8080"
+REQUEST_TIMEOUT = 10.0
+
+# サーバー側の受付制御用ヘッダー（クライアント識別とタイムアウトに合わせた期限）
+UE5_REQUEST_HEADERS = {
+    "X-Client-Id": "ue5-mcp",
+    "X-Deadline-Ms": str(int(REQUEST_TIMEOUT * 1000))
+}
 
 server = Server("ue5-control")
 
@@ -389,7 +396,7 @@ async def call_tool(name: str, arguments: dict[str, Any]) -> list[types.TextCont
     logger.info(f"Tool called: {name} with args: {arguments}")
 
     try:
-        async with httpx.AsyncClient(timeout=10.0) as client:
+        async with httpx.AsyncClient(timeout=REQUEST_TIMEOUT, headers=UE5_REQUEST_HEADERS) as client:
             # ヘルスチェック
             try:
                 health = await client.get(f"{UE5_BASE_URL}/health")
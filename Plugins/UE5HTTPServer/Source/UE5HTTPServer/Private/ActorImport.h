@@ -0,0 +1,327 @@
+// Private/ActorImport.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+// アクター1件分の作成内容。/actorsのJSONからも、インポートのNDJSON行・バイナリレコードからも同じ形に読む
+struct FActorSpawnDesc
+{
+    FString Type;
+    FString Name;
+    FVector Location = FVector::ZeroVector;
+    FLinearColor Color = FLinearColor::White;
+    FVector Scale = FVector(1.0f, 1.0f, 1.0f);
+    FVector Dimensions = FVector::ZeroVector;
+    bool bHasDimensions = false;
+    // 空ならバッチやインポートの既定プロファイル
+    FString ProfileName;
+    TOptional<float> Intensity;
+    TOptional<float> AttenuationRadius;
+};
+
+// /actorsと同じ形式のJSONを読む。必須のtype・locationが無ければfalse
+inline bool ReadActorSpawnDesc(const TSharedPtr<FJsonObject>& ActorJson, FActorSpawnDesc& OutDesc)
+{
+    const TSharedPtr<FJsonObject>* LocationObj = nullptr;
+    if (!ActorJson.IsValid() ||
+        !ActorJson->TryGetStringField(TEXT("type"), OutDesc.Type) ||
+        !ActorJson->TryGetObjectField(TEXT("location"), LocationObj))
+    {
+        return false;
+    }
+
+    ActorJson->TryGetStringField(TEXT("name"), OutDesc.Name);
+
+    OutDesc.Location = FVector(
+        (*LocationObj)->GetNumberField(TEXT("x")),
+        (*LocationObj)->GetNumberField(TEXT("y")),
+        (*LocationObj)->GetNumberField(TEXT("z"))
+    );
+
+    // 色情報の取得（オプション）
+    const TSharedPtr<FJsonObject>* ColorObj = nullptr;
+    if (ActorJson->TryGetObjectField(TEXT("color"), ColorObj))
+    {
+        OutDesc.Color = FLinearColor(
+            (*ColorObj)->GetNumberField(TEXT("r")),
+            (*ColorObj)->GetNumberField(TEXT("g")),
+            (*ColorObj)->GetNumberField(TEXT("b")),
+            (*ColorObj)->HasField(TEXT("a")) ? (*ColorObj)->GetNumberField(TEXT("a")) : 1.0f
+        );
+    }
+
+    // スケール情報の取得（オプション）
+    const TSharedPtr<FJsonObject>* ScaleObj = nullptr;
+    if (ActorJson->TryGetObjectField(TEXT("scale"), ScaleObj))
+    {
+        if ((*ScaleObj)->HasField(TEXT("uniform")))
+        {
+            const float UniformScale = (*ScaleObj)->GetNumberField(TEXT("uniform"));
+            OutDesc.Scale = FVector(UniformScale, UniformScale, UniformScale);
+        }
+        else
+        {
+            OutDesc.Scale = FVector(
+                (*ScaleObj)->HasField(TEXT("x")) ? (*ScaleObj)->GetNumberField(TEXT("x")) : 1.0f,
+                (*ScaleObj)->HasField(TEXT("y")) ? (*ScaleObj)->GetNumberField(TEXT("y")) : 1.0f,
+                (*ScaleObj)->HasField(TEXT("z")) ? (*ScaleObj)->GetNumberField(TEXT("z")) : 1.0f
+            );
+        }
+    }
+
+    // サイズ情報（dimensions）の取得（オプション）
+    const TSharedPtr<FJsonObject>* DimensionsObj = nullptr;
+    if (ActorJson->TryGetObjectField(TEXT("dimensions"), DimensionsObj))
+    {
+        OutDesc.Dimensions = FVector(
+            (*DimensionsObj)->GetNumberField(TEXT("width")),
+            (*DimensionsObj)->GetNumberField(TEXT("depth")),
+            (*DimensionsObj)->GetNumberField(TEXT("height"))
+        );
+        OutDesc.bHasDimensions = true;
+    }
+
+    ActorJson->TryGetStringField(TEXT("profile"), OutDesc.ProfileName);
+
+    double Value = 0.0;
+    if (ActorJson->TryGetNumberField(TEXT("intensity"), Value))
+    {
+        OutDesc.Intensity = static_cast<float>(Value);
+    }
+    if (ActorJson->TryGetNumberField(TEXT("attenuationRadius"), Value))
+    {
+        OutDesc.AttenuationRadius = static_cast<float>(Value);
+    }
+
+    return true;
+}
+
+enum class EActorImportFormat : uint8
+{
+    // 1行に1アクターのJSON（/actorsと同じ形式）
+    Ndjson,
+    // 固定長ヘッダー＋名前の可変長レコード（下記）
+    Binary
+};
+
+// バイナリ形式（リトルエンディアン）
+//   ファイル先頭: "UE5ACT01"（8バイト）
+//   レコード:     [uint8 種類][uint8 フラグ][uint16 名前の長さ]
+//                 [float 位置XYZ][float スケールXYZ][float 色RGBA][float サイズWDH]
+//                 [float 明るさ][float 減衰半径][名前(UTF-8)]
+//   種類:   0=Cube 1=Sphere 2=Cylinder 3=Plane 4=Light 5=Camera
+//   フラグ: bit0=サイズあり bit1=明るさあり bit2=減衰半径あり
+class FActorImportDecoder
+{
+public:
+    static constexpr int32 BinaryHeaderSize = 8;
+    static constexpr int32 BinaryRecordSize = 64;
+    // NDJSONの1行の上限。超えた行はエラーとして次の改行まで読み飛ばす（持ち越しの大きさをこの程度に抑える）
+    static constexpr int32 MaxLineLength = 256 * 1024;
+
+    explicit FActorImportDecoder(EActorImportFormat InFormat = EActorImportFormat::Ndjson)
+        : Format(InFormat)
+    {
+    }
+
+    // 受け取ったバイト列から完成したレコードを取り出す。行やレコードの途中の端数は次回に持ち越す
+    void Feed(const uint8* Data, int32 Size, TArray<FActorSpawnDesc>& OutRecords)
+    {
+        if (bInvalid)
+        {
+            return;
+        }
+
+        Carry.Append(Data, Size);
+        const int32 Consumed = Format == EActorImportFormat::Ndjson ? DecodeLines(OutRecords) : DecodeRecords(OutRecords);
+        if (Consumed > 0)
+        {
+            Carry.RemoveAt(0, Consumed, EAllowShrinking::No);
+        }
+    }
+
+    // 入力の終わり。改行で終わっていない最後の行を処理する
+    void Finish(TArray<FActorSpawnDesc>& OutRecords)
+    {
+        if (!bInvalid && !bSkippingLine && Carry.Num() > 0)
+        {
+            if (Format == EActorImportFormat::Ndjson)
+            {
+                DecodeLine(Carry.GetData(), Carry.Num(), OutRecords);
+            }
+            else
+            {
+                // 途中で切れたレコード
+                ++ErrorCount;
+            }
+        }
+        Carry.Empty();
+        ScanOffset = 0;
+        bSkippingLine = false;
+    }
+
+    // 持ち越し中の端数のバイト数
+    int32 GetCarryBytes() const { return Carry.Num(); }
+
+    // 読めなかった行・レコードの数
+    int32 GetErrorCount() const { return ErrorCount; }
+
+    // バイナリのヘッダーが不正で、以降を読めない
+    bool IsInvalid() const { return bInvalid; }
+
+private:
+    EActorImportFormat Format;
+    TArray<uint8> Carry;
+    int32 ErrorCount = 0;
+    bool bHeaderRead = false;
+    bool bInvalid = false;
+    // 持ち越し中の行のうち、改行が無いことを確認済みのバイト数（次回はその続きから探す）
+    int32 ScanOffset = 0;
+    // 上限を超えた行の残りを読み飛ばし中
+    bool bSkippingLine = false;
+
+    int32 DecodeLines(TArray<FActorSpawnDesc>& OutRecords)
+    {
+        const uint8* Data = Carry.GetData();
+        const int32 Size = Carry.Num();
+
+        int32 LineStart = 0;
+        for (int32 Index = ScanOffset; Index < Size; ++Index)
+        {
+            if (Data[Index] != '\n')
+            {
+                continue;
+            }
+
+            if (bSkippingLine)
+            {
+                bSkippingLine = false;
+            }
+            else if (Index - LineStart > MaxLineLength)
+            {
+                ++ErrorCount;
+            }
+            else
+            {
+                DecodeLine(Data + LineStart, Index - LineStart, OutRecords);
+            }
+            LineStart = Index + 1;
+        }
+
+        // 改行が来ないまま上限を超えた行は、ここまでを捨てて次の改行まで読み飛ばす
+        if (Size > LineStart && (bSkippingLine || Size - LineStart > MaxLineLength))
+        {
+            if (!bSkippingLine)
+            {
+                ++ErrorCount;
+                bSkippingLine = true;
+            }
+            ScanOffset = 0;
+            return Size;
+        }
+
+        ScanOffset = Size - LineStart;
+        return LineStart;
+    }
+
+    void DecodeLine(const uint8* Line, int32 Length, TArray<FActorSpawnDesc>& OutRecords)
+    {
+        while (Length > 0 && (Line[Length - 1] == '\r' || Line[Length - 1] == ' ' || Line[Length - 1] == '\t'))
+        {
+            --Length;
+        }
+        if (Length == 0)
+        {
+            return;
+        }
+
+        FUTF8ToTCHAR LineConverter(reinterpret_cast<const ANSICHAR*>(Line), Length);
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(FString(LineConverter.Length(), LineConverter.Get()));
+
+        TSharedPtr<FJsonObject> ActorJson;
+        FActorSpawnDesc Desc;
+        if (FJsonSerializer::Deserialize(Reader, ActorJson) && ReadActorSpawnDesc(ActorJson, Desc))
+        {
+            OutRecords.Add(MoveTemp(Desc));
+        }
+        else
+        {
+            ++ErrorCount;
+        }
+    }
+
+    int32 DecodeRecords(TArray<FActorSpawnDesc>& OutRecords)
+    {
+        const uint8* Data = Carry.GetData();
+        const int32 Size = Carry.Num();
+        int32 Offset = 0;
+
+        if (!bHeaderRead)
+        {
+            if (Size < BinaryHeaderSize)
+            {
+                return 0;
+            }
+            if (FMemory::Memcmp(Data, "UE5ACT01", BinaryHeaderSize) != 0)
+            {
+                bInvalid = true;
+                return Size;
+            }
+            bHeaderRead = true;
+            Offset = BinaryHeaderSize;
+        }
+
+        static const TCHAR* const ActorTypes[] =
+        {
+            TEXT("Cube"), TEXT("Sphere"), TEXT("Cylinder"), TEXT("Plane"), TEXT("Light"), TEXT("Camera")
+        };
+
+        while (Size - Offset >= BinaryRecordSize)
+        {
+            const uint8* Record = Data + Offset;
+            const int32 NameLength = Record[2] | (Record[3] << 8);
+            if (Size - Offset < BinaryRecordSize + NameLength)
+            {
+                break;
+            }
+
+            // 対応プラットフォームはすべてリトルエンディアンなのでそのまま読む
+            float Values[15];
+            FMemory::Memcpy(Values, Record + 4, sizeof(Values));
+
+            const uint8 Type = Record[0];
+            const uint8 Flags = Record[1];
+            if (Type < UE_ARRAY_COUNT(ActorTypes))
+            {
+                FActorSpawnDesc& Desc = OutRecords.AddDefaulted_GetRef();
+                Desc.Type = ActorTypes[Type];
+                Desc.Location = FVector(Values[0], Values[1], Values[2]);
+                Desc.Scale = FVector(Values[3], Values[4], Values[5]);
+                Desc.Color = FLinearColor(Values[6], Values[7], Values[8], Values[9]);
+                Desc.Dimensions = FVector(Values[10], Values[11], Values[12]);
+                Desc.bHasDimensions = (Flags & 0x1) != 0;
+                if (Flags & 0x2)
+                {
+                    Desc.Intensity = Values[13];
+                }
+                if (Flags & 0x4)
+                {
+                    Desc.AttenuationRadius = Values[14];
+                }
+
+                FUTF8ToTCHAR NameConverter(reinterpret_cast<const ANSICHAR*>(Record + BinaryRecordSize), NameLength);
+                Desc.Name = FString(NameConverter.Length(), NameConverter.Get());
+            }
+            else
+            {
+                ++ErrorCount;
+            }
+
+            Offset += BinaryRecordSize + NameLength;
+        }
+
+        return Offset;
+    }
+};
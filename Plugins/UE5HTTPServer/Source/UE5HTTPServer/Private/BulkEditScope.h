@@ -0,0 +1,111 @@
+// Private/BulkEditScope.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "Engine/Engine.h"
+#include "Misc/ITransaction.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#include "Selection.h"
+#endif
+
+// エディターのワールドで大量のアクターを作成・削除する間、エディター側の付随処理をまとめて後回しにするスコープ
+// ・Undoのトランザクション記録を行わない
+// ・選択変更の通知をスコープの終わりに1回だけにする
+// ・ラベル設定や削除のたびにレベルをダーティにせず、終わりに1回だけダーティにする
+// ・アウトライナーとビューポートの更新を終わりに1回だけ行う
+// PIEやゲームのワールドでは何もしない。入れ子にした場合は一番外側のスコープが後処理を行う
+class FBulkEditScope
+{
+public:
+    // bRefreshEditor: falseなら終わりのアウトライナー・ビューポート更新を省く（複数フレームに分けた処理の途中など）
+    explicit FBulkEditScope(UWorld* InWorld, bool bInRefreshEditor = true)
+        : bRefreshEditor(bInRefreshEditor)
+    {
+#if WITH_EDITOR
+        if (!GIsEditor || !GEditor || !InWorld || InWorld->WorldType != EWorldType::Editor)
+        {
+            return;
+        }
+
+        bEntered = true;
+        if (ActiveDepth++ > 0)
+        {
+            return;
+        }
+
+        World = InWorld;
+        PreviousUndo = GUndo;
+        GUndo = nullptr;
+        GEditor->GetSelectedActors()->BeginBatchSelectOperation();
+#endif
+    }
+
+    ~FBulkEditScope()
+    {
+#if WITH_EDITOR
+        if (!bEntered || --ActiveDepth > 0)
+        {
+            return;
+        }
+
+        GUndo = PreviousUndo;
+        // 溜めていた選択変更の通知をここで1回だけ送る
+        GEditor->GetSelectedActors()->EndBatchSelectOperation(true);
+
+        if (UWorld* EditedWorld = World.Get())
+        {
+            if (EditedWorld->PersistentLevel)
+            {
+                EditedWorld->PersistentLevel->MarkPackageDirty();
+            }
+        }
+
+        if (bRefreshEditor)
+        {
+            RefreshEditor();
+        }
+#endif
+    }
+
+    FBulkEditScope(const FBulkEditScope&) = delete;
+    FBulkEditScope& operator=(const FBulkEditScope&) = delete;
+
+    // アウトライナーの一覧とビューポートを作り直す
+    static void RefreshEditor()
+    {
+#if WITH_EDITOR
+        if (GIsEditor && GEditor)
+        {
+            GEngine->BroadcastLevelActorListChanged();
+            GEditor->RedrawLevelEditingViewports();
+        }
+#endif
+    }
+
+    // 一括編集中か（ラベル設定や削除でレベルのダーティ化を省くかの判定に使う）
+    static bool IsActive()
+    {
+#if WITH_EDITOR
+        return ActiveDepth > 0;
+#else
+        return false;
+#endif
+    }
+
+private:
+    bool bRefreshEditor = true;
+
+#if WITH_EDITOR
+    // ゲームスレッドからのみ使う
+    static inline int32 ActiveDepth = 0;
+
+    bool bEntered = false;
+    TWeakObjectPtr<UWorld> World;
+    ITransaction* PreviousUndo = nullptr;
+#endif
+};
@@ -0,0 +1,294 @@
+// Private/JsonResponseWriter.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// UTF-8のJSONをバイト列へ直接書き出すライター
+// FJsonObjectのDOMやUTF-16のFStringを経由しないため、完成したバッファをそのままレスポンス本体に渡せる
+class FJsonResponseWriter
+{
+public:
+    // 小数点以下の桁数の上限
+    static constexpr int32 MaxFloatPrecision = 9;
+
+    // SizeHint: 予想されるレスポンスサイズ（再確保を避けるため最初に確保する）
+    // FloatPrecision: 小数点以下の桁数（0〜MaxFloatPrecisionに丸める）。負の値は従来どおり有効数字17桁
+    explicit FJsonResponseWriter(int32 SizeHint = 256, int32 InFloatPrecision = -1)
+        : FloatPrecision(InFloatPrecision < 0 ? -1 : FMath::Min(InFloatPrecision, MaxFloatPrecision))
+    {
+        Buffer.Reserve(SizeHint);
+    }
+
+    void BeginObject()
+    {
+        WriteSeparator();
+        Buffer.Add('{');
+        Scopes.Push(false);
+    }
+
+    void EndObject()
+    {
+        Scopes.Pop(EAllowShrinking::No);
+        Buffer.Add('}');
+    }
+
+    void BeginArray()
+    {
+        WriteSeparator();
+        Buffer.Add('[');
+        Scopes.Push(false);
+    }
+
+    void EndArray()
+    {
+        Scopes.Pop(EAllowShrinking::No);
+        Buffer.Add(']');
+    }
+
+    // キーはASCIIのリテラルを想定しているのでエスケープしない
+    void Key(const ANSICHAR* Name)
+    {
+        WriteSeparator();
+        Buffer.Add('"');
+        WriteRaw(Name);
+        Buffer.Add('"');
+        Buffer.Add(':');
+        bAfterKey = true;
+    }
+
+    void String(FStringView Value)
+    {
+        WriteSeparator();
+        Buffer.Reserve(Buffer.Num() + Value.Len() + 2);
+        Buffer.Add('"');
+
+        const TCHAR* Data = Value.GetData();
+        const int32 Length = Value.Len();
+        for (int32 Index = 0; Index < Length; ++Index)
+        {
+            uint32 CodePoint = static_cast<uint32>(Data[Index]);
+
+            if (CodePoint < 0x80)
+            {
+                WriteEscapedAscii(static_cast<uint8>(CodePoint));
+                continue;
+            }
+
+            // サロゲートペアを1つのコードポイントにまとめる
+            if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF && Index + 1 < Length)
+            {
+                const uint32 LowSurrogate = static_cast<uint32>(Data[Index + 1]);
+                if (LowSurrogate >= 0xDC00 && LowSurrogate <= 0xDFFF)
+                {
+                    CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (LowSurrogate - 0xDC00);
+                    ++Index;
+                }
+            }
+
+            if (CodePoint < 0x800)
+            {
+                Buffer.Add(static_cast<uint8>(0xC0 | (CodePoint >> 6)));
+                Buffer.Add(static_cast<uint8>(0x80 | (CodePoint & 0x3F)));
+            }
+            else if (CodePoint < 0x10000)
+            {
+                Buffer.Add(static_cast<uint8>(0xE0 | (CodePoint >> 12)));
+                Buffer.Add(static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F)));
+                Buffer.Add(static_cast<uint8>(0x80 | (CodePoint & 0x3F)));
+            }
+            else
+            {
+                Buffer.Add(static_cast<uint8>(0xF0 | (CodePoint >> 18)));
+                Buffer.Add(static_cast<uint8>(0x80 | ((CodePoint >> 12) & 0x3F)));
+                Buffer.Add(static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F)));
+                Buffer.Add(static_cast<uint8>(0x80 | (CodePoint & 0x3F)));
+            }
+        }
+
+        Buffer.Add('"');
+    }
+
+    void Number(double Value)
+    {
+        WriteSeparator();
+
+        // JSONはNaN/Infを表現できない
+        if (!FMath::IsFinite(Value))
+        {
+            Buffer.Add('0');
+            return;
+        }
+
+        ANSICHAR Temp[64];
+        int32 Length = -1;
+        if (FloatPrecision >= 0)
+        {
+            Length = FCStringAnsi::Snprintf(Temp, UE_ARRAY_COUNT(Temp), "%.*f", FloatPrecision, Value);
+        }
+
+        // 固定小数点で書けた場合だけ整える。収まらない大きな値は有効数字17桁で書く
+        if (Length > 0 && Length < static_cast<int32>(UE_ARRAY_COUNT(Temp)))
+        {
+            // 末尾の0と小数点を削る
+            if (FloatPrecision > 0)
+            {
+                while (Length > 0 && Temp[Length - 1] == '0')
+                {
+                    --Length;
+                }
+                if (Length > 0 && Temp[Length - 1] == '.')
+                {
+                    --Length;
+                }
+            }
+
+            // 量子化で生じた"-0"は"0"にする
+            if (Length == 2 && Temp[0] == '-' && Temp[1] == '0')
+            {
+                Temp[0] = '0';
+                Length = 1;
+            }
+        }
+        else
+        {
+            Length = FCStringAnsi::Snprintf(Temp, UE_ARRAY_COUNT(Temp), "%.17g", Value);
+        }
+
+        Buffer.Append(reinterpret_cast<const uint8*>(Temp), FMath::Clamp(Length, 0, static_cast<int32>(UE_ARRAY_COUNT(Temp)) - 1));
+    }
+
+    void Int(int64 Value)
+    {
+        WriteSeparator();
+
+        ANSICHAR Temp[24];
+        int32 Position = UE_ARRAY_COUNT(Temp);
+        uint64 Magnitude = Value < 0 ? 0 - static_cast<uint64>(Value) : static_cast<uint64>(Value);
+        do
+        {
+            Temp[--Position] = static_cast<ANSICHAR>('0' + Magnitude % 10);
+            Magnitude /= 10;
+        }
+        while (Magnitude != 0);
+
+        if (Value < 0)
+        {
+            Temp[--Position] = '-';
+        }
+
+        Buffer.Append(reinterpret_cast<const uint8*>(Temp + Position), UE_ARRAY_COUNT(Temp) - Position);
+    }
+
+    void Bool(bool bValue)
+    {
+        WriteSeparator();
+        WriteRaw(bValue ? "true" : "false");
+    }
+
+    void Null()
+    {
+        WriteSeparator();
+        WriteRaw("null");
+    }
+
+    // 別のライターで書き出し済みのJSON断片を1つの値としてそのまま連結する
+    void RawValue(TArrayView<const uint8> Fragment)
+    {
+        WriteSeparator();
+        Buffer.Append(Fragment.GetData(), Fragment.Num());
+    }
+
+    // FJsonObjectのSet*Fieldに対応する書き込み
+    void StringField(const ANSICHAR* Name, FStringView Value)
+    {
+        Key(Name);
+        String(Value);
+    }
+
+    void NumberField(const ANSICHAR* Name, double Value)
+    {
+        Key(Name);
+        Number(Value);
+    }
+
+    void IntField(const ANSICHAR* Name, int64 Value)
+    {
+        Key(Name);
+        Int(Value);
+    }
+
+    void BoolField(const ANSICHAR* Name, bool bValue)
+    {
+        Key(Name);
+        Bool(bValue);
+    }
+
+    // 書き出し済みのバイト列をそのまま渡す（コピーしない）
+    TArray<uint8> Finish()
+    {
+        return MoveTemp(Buffer);
+    }
+
+    int32 Num() const
+    {
+        return Buffer.Num();
+    }
+
+private:
+    TArray<uint8> Buffer;
+    // 入れ子ごとの「次の要素の前にカンマが必要か」
+    TArray<bool, TInlineAllocator<16>> Scopes;
+    bool bAfterKey = false;
+    int32 FloatPrecision = -1;
+
+    void WriteSeparator()
+    {
+        if (bAfterKey)
+        {
+            bAfterKey = false;
+            return;
+        }
+
+        if (Scopes.Num() > 0)
+        {
+            if (Scopes.Last())
+            {
+                Buffer.Add(',');
+            }
+            Scopes.Last() = true;
+        }
+    }
+
+    void WriteRaw(const ANSICHAR* Text)
+    {
+        Buffer.Append(reinterpret_cast<const uint8*>(Text), FCStringAnsi::Strlen(Text));
+    }
+
+    void WriteEscapedAscii(uint8 Char)
+    {
+        switch (Char)
+        {
+        case '"':  WriteRaw("\\\""); return;
+        case '\\': WriteRaw("\\\\"); return;
+        case '\n': WriteRaw("\\n"); return;
+        case '\r': WriteRaw("\\r"); return;
+        case '\t': WriteRaw("\\t"); return;
+        case '\b': WriteRaw("\\b"); return;
+        case '\f': WriteRaw("\\f"); return;
+        default:
+            break;
+        }
+
+        if (Char < 0x20)
+        {
+            static const ANSICHAR HexDigits[] = "0123456789abcdef";
+            const uint8 Escaped[] = { '\\', 'u', '0', '0',
+                static_cast<uint8>(HexDigits[Char >> 4]), static_cast<uint8>(HexDigits[Char & 0xF]) };
+            Buffer.Append(Escaped, UE_ARRAY_COUNT(Escaped));
+            return;
+        }
+
+        Buffer.Add(Char);
+    }
+};
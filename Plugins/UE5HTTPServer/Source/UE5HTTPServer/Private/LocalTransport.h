@@ -0,0 +1,503 @@
+// Private/LocalTransport.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Containers/Queue.h"
+
+#if PLATFORM_MAC || PLATFORM_LINUX
+#define UE5HTTPSERVER_WITH_LOCAL_TRANSPORT 1
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <errno.h>
+#else
+#define UE5HTTPSERVER_WITH_LOCAL_TRANSPORT 0
+#endif
+
+// 同一ホストのクライアント向けのUnixドメインソケット転送
+// TCPスタックとHTTPのフレーミングを通さず、HTTPと同じハンドラーを呼び出す
+//
+// フレーム形式（数値はリトルエンディアン）
+//   要求: [uint32 長さ][uint32 要求ID]["METHOD PATH\n"][本体(JSON)]
+//   応答: [uint32 長さ][uint32 要求ID][uint16 ステータス][本体(JSON)]   ※長さは長さフィールドより後ろの合計
+// 応答は完了した順に返る（大きな/sceneなどは後の要求より遅れることがある）ので、クライアントは要求IDで対応を取る
+
+// 接続1本分。ソケットの読み書きはすべてトランスポートのスレッドで行う
+// ゲームスレッドは応答を送信待ちの列に積み、トランスポートのスレッドを起こすだけ（読まないクライアントでゲームスレッドが止まらない）
+class FLocalConnection
+{
+public:
+    // 1接続あたりの送信待ちの上限。超えたら応答を読まないクライアントとみなして切断する
+    static constexpr int64 MaxQueuedBytes = 256 * 1024 * 1024;
+
+    FLocalConnection(int32 InSocket, int32 InId, int32 InWakeFd)
+        : Socket(InSocket)
+        , Id(InId)
+        , WakeFd(InWakeFd)
+    {
+    }
+
+    ~FLocalConnection()
+    {
+        Close();
+    }
+
+    int32 GetId() const { return Id; }
+    int32 GetSocket() const { return Socket; }
+
+    // ゲームスレッドから呼ぶ。送信はトランスポートのスレッドが行う
+    void SendResponse(uint32 RequestId, int32 StatusCode, TArray<uint8>&& Body)
+    {
+#if UE5HTTPSERVER_WITH_LOCAL_TRANSPORT
+        if (Socket < 0 || bCloseRequested)
+        {
+            return;
+        }
+
+        const int64 FrameSize = Body.Num() + 10;
+        if (QueuedBytes + FrameSize > MaxQueuedBytes)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Local transport connection %d is not reading responses; closing"), Id);
+            bCloseRequested = true;
+            Wake();
+            return;
+        }
+
+        const uint32 Length = Body.Num() + 6;
+        TArray<uint8> Header =
+        {
+            static_cast<uint8>(Length), static_cast<uint8>(Length >> 8),
+            static_cast<uint8>(Length >> 16), static_cast<uint8>(Length >> 24),
+            static_cast<uint8>(RequestId), static_cast<uint8>(RequestId >> 8),
+            static_cast<uint8>(RequestId >> 16), static_cast<uint8>(RequestId >> 24),
+            static_cast<uint8>(StatusCode), static_cast<uint8>(StatusCode >> 8)
+        };
+
+        QueuedBytes += FrameSize;
+        Outbox.Enqueue(MoveTemp(Header));
+        Outbox.Enqueue(MoveTemp(Body));
+        Wake();
+#endif
+    }
+
+    // トランスポートのスレッド（または停止後のゲームスレッド）から呼ぶ
+    void Close()
+    {
+#if UE5HTTPSERVER_WITH_LOCAL_TRANSPORT
+        const int32 ClosingSocket = Socket.Exchange(-1);
+        if (ClosingSocket >= 0)
+        {
+            close(ClosingSocket);
+        }
+#endif
+    }
+
+    // 以下はトランスポートのスレッド専用
+
+    bool HasPendingOutput() const
+    {
+        return SendOffset < Sending.Num() || !Outbox.IsEmpty();
+    }
+
+    bool IsCloseRequested() const { return bCloseRequested; }
+
+    // 送れるだけ送る。ソケットのバッファが一杯なら残りは次のPOLLOUTで送る。エラーならfalse
+    bool FlushOutput()
+    {
+#if UE5HTTPSERVER_WITH_LOCAL_TRANSPORT
+#if PLATFORM_LINUX
+        const int SendFlags = MSG_NOSIGNAL;
+#else
+        const int SendFlags = 0;
+#endif
+        while (true)
+        {
+            if (SendOffset >= Sending.Num())
+            {
+                Sending.Reset();
+                SendOffset = 0;
+                if (!Outbox.Dequeue(Sending))
+                {
+                    return true;
+                }
+                continue;
+            }
+
+            const ssize_t Sent = send(Socket, Sending.GetData() + SendOffset, Sending.Num() - SendOffset, SendFlags);
+            if (Sent < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                return errno == EAGAIN || errno == EWOULDBLOCK;
+            }
+
+            SendOffset += static_cast<int32>(Sent);
+            QueuedBytes -= Sent;
+        }
+#else
+        return true;
+#endif
+    }
+
+    // 受信途中のフレーム
+    TArray<uint8> ReadBuffer;
+
+private:
+    TAtomic<int32> Socket;
+    int32 Id;
+    // トランスポートのスレッドのpollを起こすパイプの書き込み側
+    int32 WakeFd;
+    TAtomic<bool> bCloseRequested { false };
+    TAtomic<int64> QueuedBytes { 0 };
+
+    // ゲームスレッド（とフレーム不正時のトランスポートのスレッド）が積み、トランスポートのスレッドが取り出す
+    TQueue<TArray<uint8>, EQueueMode::Mpsc> Outbox;
+    // 送信中のバッファと送信済みのバイト数（トランスポートのスレッド専用）
+    TArray<uint8> Sending;
+    int32 SendOffset = 0;
+
+    void Wake()
+    {
+#if UE5HTTPSERVER_WITH_LOCAL_TRANSPORT
+        const uint8 Byte = 0;
+        // パイプが一杯でも既に起こしてあるので失敗してよい
+        (void)write(WakeFd, &Byte, 1);
+#endif
+    }
+};
+
+// 受信したコマンド。ゲームスレッドでルートに振り分ける
+struct FLocalCommand
+{
+    TSharedPtr<FLocalConnection, ESPMode::ThreadSafe> Connection;
+    // 応答にそのまま返す
+    uint32 RequestId = 0;
+    FString Verb;
+    FString Path;
+    TArray<uint8> Body;
+};
+
+class FLocalTransportServer : public FRunnable
+{
+public:
+    // 1フレームの上限（/actors/batchの大きな本体も通せるように）
+    static constexpr uint32 MaxFrameSize = 64 * 1024 * 1024;
+
+    ~FLocalTransportServer()
+    {
+        StopListening();
+    }
+
+    bool StartListening(const FString& InSocketPath)
+    {
+#if UE5HTTPSERVER_WITH_LOCAL_TRANSPORT
+        FTCHARToUTF8 PathUtf8(*InSocketPath);
+
+        sockaddr_un Address = {};
+        Address.sun_family = AF_UNIX;
+        if (PathUtf8.Length() <= 0 || PathUtf8.Length() >= static_cast<int32>(sizeof(Address.sun_path)))
+        {
+            UE_LOG(LogTemp, Error, TEXT("Invalid local socket path: %s"), *InSocketPath);
+            return false;
+        }
+        FMemory::Memcpy(Address.sun_path, PathUtf8.Get(), PathUtf8.Length());
+
+        // 前回の異常終了で残ったソケットファイルだけを消す（ソケット以外のファイルは消さない）
+        struct stat Existing;
+        if (lstat(PathUtf8.Get(), &Existing) == 0)
+        {
+            if (!S_ISSOCK(Existing.st_mode))
+            {
+                UE_LOG(LogTemp, Error, TEXT("Local socket path exists and is not a socket: %s"), *InSocketPath);
+                return false;
+            }
+            unlink(PathUtf8.Get());
+        }
+
+        int WakePipe[2];
+        if (pipe(WakePipe) != 0)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to create local transport wake pipe"));
+            return false;
+        }
+        WakeReadFd = WakePipe[0];
+        WakeWriteFd = WakePipe[1];
+        SetNonBlocking(WakeReadFd);
+        SetNonBlocking(WakeWriteFd);
+
+        ListenSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (ListenSocket < 0)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to create local socket"));
+            CloseWakePipe();
+            return false;
+        }
+
+        if (bind(ListenSocket, reinterpret_cast<sockaddr*>(&Address), sizeof(Address)) != 0 || listen(ListenSocket, 16) != 0)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to listen on local socket: %s"), *InSocketPath);
+            close(ListenSocket);
+            ListenSocket = -1;
+            CloseWakePipe();
+            return false;
+        }
+
+        SocketPath = InSocketPath;
+        bStopping = false;
+        ReceiveScratch.SetNumUninitialized(64 * 1024);
+        Thread = FRunnableThread::Create(this, TEXT("UE5HTTPServerLocalTransport"));
+        return Thread != nullptr;
+#else
+        UE_LOG(LogTemp, Warning, TEXT("Local transport is not supported on this platform"));
+        return false;
+#endif
+    }
+
+    void StopListening()
+    {
+        bStopping = true;
+
+        if (Thread)
+        {
+            Thread->WaitForCompletion();
+            delete Thread;
+            Thread = nullptr;
+        }
+
+#if UE5HTTPSERVER_WITH_LOCAL_TRANSPORT
+        for (const TSharedPtr<FLocalConnection, ESPMode::ThreadSafe>& Connection : Connections)
+        {
+            Connection->Close();
+        }
+        Connections.Reset();
+
+        if (ListenSocket >= 0)
+        {
+            close(ListenSocket);
+            ListenSocket = -1;
+            unlink(TCHAR_TO_UTF8(*SocketPath));
+        }
+
+        CloseWakePipe();
+#endif
+    }
+
+    // ゲームスレッドから呼ぶ
+    bool DequeueCommand(FLocalCommand& OutCommand)
+    {
+        return Commands.Dequeue(OutCommand);
+    }
+
+    virtual uint32 Run() override
+    {
+#if UE5HTTPSERVER_WITH_LOCAL_TRANSPORT
+        TArray<pollfd> PollFds;
+
+        while (!bStopping)
+        {
+            // 閉じた接続・切断を求められた接続を外してから、送れる分を先に送る
+            for (int32 Index = Connections.Num() - 1; Index >= 0; --Index)
+            {
+                const TSharedPtr<FLocalConnection, ESPMode::ThreadSafe>& Connection = Connections[Index];
+                if (Connection->GetSocket() < 0 || Connection->IsCloseRequested() || !Connection->FlushOutput())
+                {
+                    Connection->Close();
+                    Connections.RemoveAtSwap(Index);
+                }
+            }
+
+            PollFds.Reset();
+            PollFds.Add({ WakeReadFd, POLLIN, 0 });
+            PollFds.Add({ ListenSocket, POLLIN, 0 });
+            for (const TSharedPtr<FLocalConnection, ESPMode::ThreadSafe>& Connection : Connections)
+            {
+                const short Events = Connection->HasPendingOutput() ? (POLLIN | POLLOUT) : POLLIN;
+                PollFds.Add({ Connection->GetSocket(), Events, 0 });
+            }
+
+            // 停止要求に気付けるよう短いタイムアウトで待つ（応答の送信はパイプで起こされる）
+            if (poll(PollFds.GetData(), PollFds.Num(), 100) <= 0)
+            {
+                continue;
+            }
+
+            if (PollFds[0].revents & POLLIN)
+            {
+                uint8 Drain[64];
+                while (read(WakeReadFd, Drain, sizeof(Drain)) > 0)
+                {
+                }
+            }
+
+            // 既存の接続を先に処理する（受け付けた接続はPollFdsに含まれない）
+            for (int32 Index = PollFds.Num() - 1; Index >= 2; --Index)
+            {
+                const short Events = PollFds[Index].revents;
+                if (Events == 0)
+                {
+                    continue;
+                }
+
+                TSharedPtr<FLocalConnection, ESPMode::ThreadSafe> Connection = Connections[Index - 2];
+                const bool bAlive =
+                    (!(Events & POLLOUT) || Connection->FlushOutput()) &&
+                    (!(Events & (POLLIN | POLLHUP | POLLERR)) || ReceiveFromConnection(Connection));
+                if (!bAlive)
+                {
+                    Connection->Close();
+                    Connections.RemoveAt(Index - 2);
+                }
+            }
+
+            if (PollFds[1].revents & POLLIN)
+            {
+                AcceptConnection();
+            }
+        }
+#endif
+        return 0;
+    }
+
+    virtual void Stop() override
+    {
+        bStopping = true;
+    }
+
+private:
+    int32 ListenSocket = -1;
+    int32 WakeReadFd = -1;
+    int32 WakeWriteFd = -1;
+    int32 NextConnectionId = 1;
+    FString SocketPath;
+    FRunnableThread* Thread = nullptr;
+    TAtomic<bool> bStopping { false };
+    TArray<TSharedPtr<FLocalConnection, ESPMode::ThreadSafe>> Connections;
+    TArray<uint8> ReceiveScratch;
+    TQueue<FLocalCommand, EQueueMode::Spsc> Commands;
+
+#if UE5HTTPSERVER_WITH_LOCAL_TRANSPORT
+    static void SetNonBlocking(int32 Fd)
+    {
+        fcntl(Fd, F_SETFL, fcntl(Fd, F_GETFL, 0) | O_NONBLOCK);
+    }
+
+    void CloseWakePipe()
+    {
+        if (WakeReadFd >= 0)
+        {
+            close(WakeReadFd);
+            WakeReadFd = -1;
+        }
+        if (WakeWriteFd >= 0)
+        {
+            close(WakeWriteFd);
+            WakeWriteFd = -1;
+        }
+    }
+
+    void AcceptConnection()
+    {
+        const int32 Socket = accept(ListenSocket, nullptr, nullptr);
+        if (Socket < 0)
+        {
+            return;
+        }
+
+        SetNonBlocking(Socket);
+
+#if PLATFORM_MAC
+        // 切断済みの相手への送信でSIGPIPEを受けないようにする
+        int NoSigPipe = 1;
+        setsockopt(Socket, SOL_SOCKET, SO_NOSIGPIPE, &NoSigPipe, sizeof(NoSigPipe));
+#endif
+
+        Connections.Add(MakeShared<FLocalConnection, ESPMode::ThreadSafe>(Socket, NextConnectionId++, WakeWriteFd));
+    }
+
+    // 受信して完成したフレームをコマンドとして積む。切断やエラーならfalse
+    bool ReceiveFromConnection(const TSharedPtr<FLocalConnection, ESPMode::ThreadSafe>& Connection)
+    {
+        const ssize_t Received = recv(Connection->GetSocket(), ReceiveScratch.GetData(), ReceiveScratch.Num(), 0);
+        if (Received <= 0)
+        {
+            return Received < 0 && (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK);
+        }
+
+        TArray<uint8>& Buffer = Connection->ReadBuffer;
+        Buffer.Append(ReceiveScratch.GetData(), static_cast<int32>(Received));
+
+        int32 Offset = 0;
+        while (Buffer.Num() - Offset >= 4)
+        {
+            const uint8* Frame = Buffer.GetData() + Offset;
+            const uint32 Length = Frame[0] | (Frame[1] << 8) | (Frame[2] << 16) | (static_cast<uint32>(Frame[3]) << 24);
+            if (Length > MaxFrameSize)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("Local transport frame too large (%u bytes)"), Length);
+                return false;
+            }
+
+            if (static_cast<uint32>(Buffer.Num() - Offset - 4) < Length)
+            {
+                break;
+            }
+
+            EnqueueFrame(Connection, Frame + 4, Length);
+            Offset += 4 + Length;
+        }
+
+        if (Offset > 0)
+        {
+            Buffer.RemoveAt(0, Offset, EAllowShrinking::No);
+        }
+        return true;
+    }
+
+    void EnqueueFrame(const TSharedPtr<FLocalConnection, ESPMode::ThreadSafe>& Connection, const uint8* Data, uint32 Length)
+    {
+        if (Length < 4)
+        {
+            Connection->SendResponse(0, 400, TArray<uint8>());
+            return;
+        }
+
+        const uint32 RequestId = Data[0] | (Data[1] << 8) | (Data[2] << 16) | (static_cast<uint32>(Data[3]) << 24);
+        Data += 4;
+        Length -= 4;
+
+        // 1行目が"METHOD PATH"、残りが本体
+        uint32 HeaderLength = 0;
+        while (HeaderLength < Length && Data[HeaderLength] != '\n')
+        {
+            ++HeaderLength;
+        }
+
+        FUTF8ToTCHAR HeaderConverter(reinterpret_cast<const ANSICHAR*>(Data), HeaderLength);
+        const FString HeaderLine(HeaderConverter.Length(), HeaderConverter.Get());
+
+        FLocalCommand Command;
+        Command.Connection = Connection;
+        Command.RequestId = RequestId;
+        if (!HeaderLine.Split(TEXT(" "), &Command.Verb, &Command.Path))
+        {
+            Connection->SendResponse(RequestId, 400, TArray<uint8>());
+            return;
+        }
+
+        if (HeaderLength + 1 < Length)
+        {
+            Command.Body.Append(Data + HeaderLength + 1, Length - HeaderLength - 1);
+        }
+
+        Commands.Enqueue(MoveTemp(Command));
+    }
+#endif
+};
@@ -17,11 +17,121 @@
 #include "EngineUtils.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "Materials/Material.h"
+#include "Containers/Ticker.h"
+#include "Engine/CollisionProfile.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "IPAddress.h"
+#include "ActorImport.h"
+#include "BulkEditScope.h"
+#include "JsonResponseWriter.h"
+#include "LocalTransport.h"
+#include "UE5HTTPServerSettings.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UnrealType.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Tasks/Task.h"
 
 #if WITH_EDITOR
 #include "Editor.h"
 #endif
 
+// 事前エンコード済みの固定レスポンス本体
+static const ANSICHAR HealthOkBody[] = "{\"status\":\"ok\"}";
+static const ANSICHAR SuccessBody[] = "{\"status\":\"success\"}";
+
+// 補間（トゥイーン）の対象プロパティ
+enum class ETweenProperty : uint8
+{
+    Location,
+    Rotation,
+    Scale,
+    Color
+};
+
+// 補間のイージングカーブ
+enum class ETweenEasing : uint8
+{
+    Linear,
+    EaseIn,
+    EaseOut,
+    EaseInOut
+};
+
+// スポーン時に適用する軽量化設定
+struct FSpawnProfile
+{
+    const TCHAR* Name;
+    bool bCollision;
+    bool bGenerateOverlapEvents;
+    bool bCastShadow;
+    EComponentMobility::Type Mobility;
+};
+
+// "visual-only"  : 表示専用。コリジョン・オーバーラップ・影なし、メッシュはStatic（移動しない前提）
+// "visual-movable": 表示専用だが移動・補間できるようMovable
+static const FSpawnProfile SpawnProfiles[] =
+{
+    { TEXT("visual-only"),    false, false, false, EComponentMobility::Static },
+    { TEXT("visual-movable"), false, false, false, EComponentMobility::Movable },
+};
+
+// 解決済みのプロパティパス（"StaticMeshComponent.CastShadow"など）
+// クラス+パスごとに一度だけ解決し、以降のリクエストでは再検索しない
+struct FResolvedPropertyPath
+{
+    // 先頭から順に辿るプロパティ。途中のFObjectPropertyはオブジェクトへ、FStructPropertyは構造体へ潜る
+    TArray<FProperty*, TInlineAllocator<4>> Chain;
+};
+
+// /sceneの整形用にゲームスレッドで取るスナップショット（アクターごとの値を種類別の配列に詰める）
+struct FSceneSnapshot
+{
+    // 位置XYZ・回転PYR・スケールXYZの9要素
+    static constexpr int32 TransformStride = 9;
+
+    // クラス名はテーブルにまとめ、アクター側はインデックスだけを持つ
+    TArray<FString> ClassNames;
+    TArray<FString> Labels;
+    TArray<int32> ClassIndices;
+    TArray<double> Transforms;
+
+    int32 Num() const { return Labels.Num(); }
+};
+
+// 1チャンクあたりのアクター数と、1アクターあたりの出力サイズの目安
+static constexpr int32 SceneChunkSize = 512;
+static constexpr int32 SceneBytesPerActor = 256;
+
+// リクエストの対象にできるワールド。ワールドコンテキストの一覧から作り、PIEの開始・終了時などに作り直す
+struct FTargetWorld
+{
+    // "editor"、"game"、"pie:0"のような指定用の名前
+    FString Name;
+    FName ContextHandle;
+    TWeakObjectPtr<UWorld> World;
+    EWorldType::Type WorldType = EWorldType::None;
+};
+
+// インポートでファイルから一度に読むバイト数と、一度に補充するレコード数の目安
+static constexpr int32 ImportReadBlockSize = 64 * 1024;
+static constexpr int32 ImportRefillRecords = 1024;
+
+// 実行中の補間1件分。全件を連続した配列で保持し、1回のTickでまとめて進める
+struct FActorTween
+{
+    TWeakObjectPtr<AActor> Actor;
+    ETweenProperty Property = ETweenProperty::Location;
+    ETweenEasing Easing = ETweenEasing::Linear;
+    double StartTime = 0.0;
+    double Duration = 0.0;
+    FVector4 From = FVector4(0.0, 0.0, 0.0, 0.0);
+    // 通過点（最後の要素が終点）。単純な補間では終点1つのみなのでインラインに収まる
+    TArray<FVector4, TInlineAllocator<1>> Keyframes;
+};
+
 class UE5HTTPServer
 {
 public:
@@ -47,11 +157,83 @@ public:
 
         SetupRoutes();
         HttpServerModule->StartAllListeners();
+
+        // 補間をまとめて進めるTick
+        TweenTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw(this, &UE5HTTPServer::TickTweens));
+
+        // 待ち行列のリクエストをフレーム予算内で処理するTick
+        RequestQueueTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw(this, &UE5HTTPServer::TickRequestQueue));
+
+        // インポートのアクター作成をフレーム予算内で進めるTick
+        ImportTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateRaw(this, &UE5HTTPServer::TickImports));
+
+        // 対象ワールドの一覧は、ワールドの増減があったときだけ作り直す
+        WorldInitializedHandle = FWorldDelegates::OnPostWorldInitialization.AddRaw(this, &UE5HTTPServer::OnWorldInitialized);
+        WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddRaw(this, &UE5HTTPServer::OnWorldCleanup);
+#if WITH_EDITOR
+        PIEStartedHandle = FEditorDelegates::PostPIEStarted.AddRaw(this, &UE5HTTPServer::OnPIEChanged);
+        PIEEndedHandle = FEditorDelegates::EndPIE.AddRaw(this, &UE5HTTPServer::OnPIEChanged);
+#endif
+        bTargetWorldsDirty = true;
+
+        // 同一ホスト向けのローカル転送（オプション）
+        const FString LocalSocketPath = CVarLocalSocketPath.GetValueOnGameThread();
+        if (!LocalSocketPath.IsEmpty())
+        {
+            LocalTransport = MakeUnique<FLocalTransportServer>();
+            if (LocalTransport->StartListening(LocalSocketPath))
+            {
+                UE_LOG(LogTemp, Warning, TEXT("Local transport listening on %s"), *LocalSocketPath);
+            }
+            else
+            {
+                LocalTransport.Reset();
+            }
+        }
+
         UE_LOG(LogTemp, Warning, TEXT("HTTP Server started on port 8080"));
     }
 
     void StopServer()
     {
+        if (TweenTickerHandle.IsValid())
+        {
+            FTSTicker::GetCoreTicker().RemoveTicker(TweenTickerHandle);
+            TweenTickerHandle.Reset();
+        }
+        ActiveTweens.Reset();
+
+        if (RequestQueueTickerHandle.IsValid())
+        {
+            FTSTicker::GetCoreTicker().RemoveTicker(RequestQueueTickerHandle);
+            RequestQueueTickerHandle.Reset();
+        }
+        LocalTransport.Reset();
+
+        ClientQueues.Reset();
+        QueuedPerRoute.Reset();
+        QueuedRequestCount = 0;
+
+        ActorGroups.Reset();
+
+        if (ImportTickerHandle.IsValid())
+        {
+            FTSTicker::GetCoreTicker().RemoveTicker(ImportTickerHandle);
+            ImportTickerHandle.Reset();
+        }
+        ImportJobs.Reset();
+
+        FWorldDelegates::OnPostWorldInitialization.Remove(WorldInitializedHandle);
+        FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+#if WITH_EDITOR
+        FEditorDelegates::PostPIEStarted.Remove(PIEStartedHandle);
+        FEditorDelegates::EndPIE.Remove(PIEEndedHandle);
+#endif
+        TargetWorlds.Reset();
+
         if (HttpServerModule)
         {
             HttpServerModule->StopAllListeners();
@@ -63,791 +245,3043 @@ private:
     FHttpServerModule* HttpServerModule;
     TSharedPtr<IHttpRouter> HttpRouter;
 
+    // 実行中の補間
+    TArray<FActorTween> ActiveTweens;
+    FTSTicker::FDelegateHandle TweenTickerHandle;
+
+    // 受付制御：待ち行列はクライアントごとに分け、ラウンドロビンで取り出す
+    using FRequestHandler = bool (UE5HTTPServer::*)(const FHttpServerRequest&, const FHttpResultCallback&);
+
+    struct FPendingRequest
+    {
+        TSharedPtr<FHttpServerRequest> Request;
+        FHttpResultCallback OnComplete;
+        FRequestHandler Handler = nullptr;
+        FName Route;
+        // 0は期限なし
+        double Deadline = 0.0;
+    };
+
+    struct FClientQueue
+    {
+        FString ClientId;
+        TArray<FPendingRequest> Pending;
+    };
+
+    // 登録済みルート（ローカル転送のコマンドを同じハンドラーへ振り分けるため）
+    struct FRouteEntry
+    {
+        EHttpServerRequestVerbs Verb = EHttpServerRequestVerbs::VERB_NONE;
+        FName Name;
+        FRequestHandler Handler = nullptr;
+        // "/"で区切ったパス。":"で始まる要素はパラメータ
+        TArray<FString> Segments;
+    };
+
+    TArray<FRouteEntry> Routes;
+
+    // アクターグループ。メンバーは弱参照の連続配列で持ち、グループ操作は1回のループで済ませる
+    // メンバーがいなくなったグループは登録から外す
+    struct FActorGroup
+    {
+        FString Name;
+        TArray<TWeakObjectPtr<AActor>> Members;
+        // インポートで追加中（空でも外さない）
+        bool bImporting = false;
+    };
+
+    TMap<int32, FActorGroup> ActorGroups;
+    int32 NextGroupId = 1;
+
+    // 大きなシーンのインポート。入力は少しずつ読んでデコードし、未作成のレコードは上限件数までしか持たない
+    struct FImportJob
+    {
+        EActorImportFormat Format = EActorImportFormat::Ndjson;
+        FActorImportDecoder Decoder;
+        // ファイルから読む場合のハンドル（チャンクのアップロードではnullptr）
+        TUniquePtr<IFileHandle> File;
+        TWeakObjectPtr<UWorld> World;
+        const FSpawnProfile* DefaultProfile = nullptr;
+        int32 GroupId = 0;
+        // デコード済みで未作成のレコード（PendingHeadより後ろが未処理）
+        TArray<FActorSpawnDesc> Pending;
+        int32 PendingHead = 0;
+        // 不明（アップロード）なら-1
+        int64 TotalBytes = -1;
+        int64 BytesRead = 0;
+        int32 Spawned = 0;
+        int32 Failed = 0;
+        bool bInputFinished = false;
+        bool bCompleted = false;
+        bool bCancelled = false;
+        FString Error;
+        double StartTime = 0.0;
+        double EndTime = 0.0;
+
+        int32 NumPending() const { return Pending.Num() - PendingHead; }
+    };
+
+    TMap<int32, FImportJob> ImportJobs;
+    int32 NextImportId = 1;
+    // ファイルの読み込み用に使い回すバッファ
+    TArray<uint8> ImportReadBuffer;
+    FTSTicker::FDelegateHandle ImportTickerHandle;
+
+    // /batchの1操作分の結果
+    struct FBatchOperationResult
+    {
+        bool bCompleted = false;
+        int32 StatusCode = 0;
+        TArray<uint8> Body;
+        // 後続の操作から参照されたときに一度だけ解析する
+        TSharedPtr<FJsonObject> ParsedBody;
+    };
+
+    // 複数ワールドへの同時実行（ファンアウト）の集計。ハンドラーが非同期に完了しても全ワールド分そろってから返す
+    struct FFanOutState
+    {
+        FHttpResultCallback OnComplete;
+        TArray<FString, TInlineAllocator<4>> WorldNames;
+        TArray<FBatchOperationResult, TInlineAllocator<4>> Results;
+        int32 Remaining = 0;
+    };
+
+    // 対象にできるワールドの一覧（bTargetWorldsDirtyのときだけ作り直す）
+    TArray<FTargetWorld> TargetWorlds;
+    bool bTargetWorldsDirty = true;
+    FDelegateHandle WorldInitializedHandle;
+    FDelegateHandle WorldCleanupHandle;
+    FDelegateHandle PIEStartedHandle;
+    FDelegateHandle PIEEndedHandle;
+
+    // 実行中のリクエストの対象ワールド（設定中はGetGameWorldがこれを返す）
+    UWorld* CurrentWorld = nullptr;
+
+    // /batchの各操作に渡す解析済みの本体（設定中はParseJsonBodyがこれを返す）
+    TSharedPtr<FJsonObject> PreparsedBody;
+    // /batchの操作の実行中。ハンドラーは非同期にせず、その場で応答を返す
+    bool bRespondInline = false;
+    TUniquePtr<FLocalTransportServer> LocalTransport;
+
+    TArray<FClientQueue> ClientQueues;
+    TMap<FName, int32> QueuedPerRoute;
+    int32 QueuedRequestCount = 0;
+    int32 RoundRobinIndex = 0;
+    // 現在のフレームでリクエスト処理に使った時間
+    double FrameWorkSeconds = 0.0;
+    FTSTicker::FDelegateHandle RequestQueueTickerHandle;
+
+    // クラスごとの解決済みプロパティパス（解決に失敗したパスは記録しない）
+    TMap<FObjectKey, TMap<FString, FResolvedPropertyPath>> PropertyPathCache;
+
     void SetupRoutes()
     {
         // ヘルスチェック
         HttpRouter->BindRoute(FHttpPath(TEXT("/health")), 
             EHttpServerRequestVerbs::VERB_GET,
             FHttpRequestHandler::CreateLambda(
-                [](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+                [this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
                 {
-                    auto Response = FHttpServerResponse::Create(TEXT("{\"status\":\"ok\"}"), TEXT("application/json"));
-                    OnComplete(MoveTemp(Response));
+                    SendPreencodedResponse(OnComplete, HealthOkBody);
                     return true;
                 }
             ));
 
         // アクター作成
-        HttpRouter->BindRoute(FHttpPath(TEXT("/actors")), 
-            EHttpServerRequestVerbs::VERB_POST,
-            FHttpRequestHandler::CreateLambda(
-                [this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
-                {
-                    return HandleCreateActor(Request, OnComplete);
-                }
-            ));
+        BindRoute(TEXT("/actors"), EHttpServerRequestVerbs::VERB_POST, &UE5HTTPServer::HandleCreateActor);
 
         // バッチアクター作成
-        HttpRouter->BindRoute(FHttpPath(TEXT("/actors/batch")), 
-            EHttpServerRequestVerbs::VERB_POST,
-            FHttpRequestHandler::CreateLambda(
-                [this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
-                {
-                    return HandleCreateActorsBatch(Request, OnComplete);
-                }
-            ));
+        BindRoute(TEXT("/actors/batch"), EHttpServerRequestVerbs::VERB_POST, &UE5HTTPServer::HandleCreateActorsBatch);
 
         // アクター移動
-        HttpRouter->BindRoute(FHttpPath(TEXT("/actors/*/location")), 
-            EHttpServerRequestVerbs::VERB_PUT,
-            FHttpRequestHandler::CreateLambda(
-                [this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
-                {
-                    return HandleMoveActor(Request, OnComplete);
-                }
-            ));
+        BindRoute(TEXT("/actors/:id/location"), EHttpServerRequestVerbs::VERB_PUT, &UE5HTTPServer::HandleMoveActor);
 
         // アクター回転
-        HttpRouter->BindRoute(FHttpPath(TEXT("/actors/*/rotation")), 
-            EHttpServerRequestVerbs::VERB_PUT,
-            FHttpRequestHandler::CreateLambda(
-                [this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
-                {
-                    return HandleRotateActor(Request, OnComplete);
-                }
-            ));
+        BindRoute(TEXT("/actors/:id/rotation"), EHttpServerRequestVerbs::VERB_PUT, &UE5HTTPServer::HandleRotateActor);
 
         // アクター色変更
-        HttpRouter->BindRoute(FHttpPath(TEXT("/actors/*/color")), 
-            EHttpServerRequestVerbs::VERB_PUT,
-            FHttpRequestHandler::CreateLambda(
-                [this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
-                {
-                    return HandleSetActorColor(Request, OnComplete);
-                }
-            ));
+        BindRoute(TEXT("/actors/:id/color"), EHttpServerRequestVerbs::VERB_PUT, &UE5HTTPServer::HandleSetActorColor);
 
         // アクタースケール変更
-        HttpRouter->BindRoute(FHttpPath(TEXT("/actors/*/scale")), 
-            EHttpServerRequestVerbs::VERB_PUT,
-            FHttpRequestHandler::CreateLambda(
-                [this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
-                {
-                    return HandleSetActorScale(Request, OnComplete);
-                }
-            ));
+        BindRoute(TEXT("/actors/:id/scale"), EHttpServerRequestVerbs::VERB_PUT, &UE5HTTPServer::HandleSetActorScale);
 
         // アクター削除
-        HttpRouter->BindRoute(FHttpPath(TEXT("/actors/*")), 
-            EHttpServerRequestVerbs::VERB_DELETE,
-            FHttpRequestHandler::CreateLambda(
-                [this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
-                {
-                    return HandleDeleteActor(Request, OnComplete);
-                }
-            ));
+        BindRoute(TEXT("/actors/:id"), EHttpServerRequestVerbs::VERB_DELETE, &UE5HTTPServer::HandleDeleteActor);
+
+        // アクターのプロパティ一括変更（リフレクション経由）
+        BindRoute(TEXT("/actors/:id"), EHttpServerRequestVerbs::VERB_PATCH, &UE5HTTPServer::HandlePatchActor);
 
         // 全アクター削除
-        HttpRouter->BindRoute(FHttpPath(TEXT("/actors")), 
-            EHttpServerRequestVerbs::VERB_DELETE,
-            FHttpRequestHandler::CreateLambda(
-                [this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
-                {
-                    return HandleDeleteAllActors(Request, OnComplete);
-                }
-            ));
+        BindRoute(TEXT("/actors"), EHttpServerRequestVerbs::VERB_DELETE, &UE5HTTPServer::HandleDeleteAllActors);
 
         // シーン情報取得
-        HttpRouter->BindRoute(FHttpPath(TEXT("/scene")), 
-            EHttpServerRequestVerbs::VERB_GET,
+        BindRoute(TEXT("/scene"), EHttpServerRequestVerbs::VERB_GET, &UE5HTTPServer::HandleGetSceneInfo);
+
+        // アクターグループ
+        BindRoute(TEXT("/groups"), EHttpServerRequestVerbs::VERB_POST, &UE5HTTPServer::HandleCreateGroup);
+        BindRoute(TEXT("/groups/:id"), EHttpServerRequestVerbs::VERB_GET, &UE5HTTPServer::HandleGetGroup);
+        BindRoute(TEXT("/groups/:id/translate"), EHttpServerRequestVerbs::VERB_PUT, &UE5HTTPServer::HandleTranslateGroup);
+        BindRoute(TEXT("/groups/:id/rotate"), EHttpServerRequestVerbs::VERB_PUT, &UE5HTTPServer::HandleRotateGroup);
+        BindRoute(TEXT("/groups/:id/color"), EHttpServerRequestVerbs::VERB_PUT, &UE5HTTPServer::HandleSetGroupColor);
+        BindRoute(TEXT("/groups/:id/scale"), EHttpServerRequestVerbs::VERB_PUT, &UE5HTTPServer::HandleSetGroupScale);
+        BindRoute(TEXT("/groups/:id"), EHttpServerRequestVerbs::VERB_DELETE, &UE5HTTPServer::HandleDeleteGroup);
+
+        // 大きなシーンのインポート（ファイルまたはチャンクのアップロード）
+        BindRoute(TEXT("/imports"), EHttpServerRequestVerbs::VERB_POST, &UE5HTTPServer::HandleCreateImport);
+        BindRoute(TEXT("/imports/:id/chunks"), EHttpServerRequestVerbs::VERB_POST, &UE5HTTPServer::HandleImportChunk);
+        BindRoute(TEXT("/imports/:id"), EHttpServerRequestVerbs::VERB_GET, &UE5HTTPServer::HandleGetImport);
+        BindRoute(TEXT("/imports/:id"), EHttpServerRequestVerbs::VERB_DELETE, &UE5HTTPServer::HandleCancelImport);
+
+        // 対象にできるワールドの一覧
+        BindRoute(TEXT("/worlds"), EHttpServerRequestVerbs::VERB_GET, &UE5HTTPServer::HandleGetWorlds);
+
+        // 複数の操作を1回のリクエストでまとめて実行
+        BindRoute(TEXT("/batch"), EHttpServerRequestVerbs::VERB_POST, &UE5HTTPServer::HandleBatch);
+
+        UE_LOG(LogTemp, Warning, TEXT("HTTP routes configured"));
+    }
+
+    // HTTPルーターへの登録と同時に、ローカル転送から引けるようルート表にも記録する
+    void BindRoute(const TCHAR* Path, EHttpServerRequestVerbs Verb, FRequestHandler Handler)
+    {
+        FRouteEntry& Entry = Routes.AddDefaulted_GetRef();
+        Entry.Verb = Verb;
+        Entry.Name = FName(*FString::Printf(TEXT("%s %s"), VerbToString(Verb), Path));
+        Entry.Handler = Handler;
+        FString(Path).ParseIntoArray(Entry.Segments, TEXT("/"), true);
+
+        const FName RouteName = Entry.Name;
+        HttpRouter->BindRoute(FHttpPath(Path), Verb,
             FHttpRequestHandler::CreateLambda(
-                [this](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+                [this, RouteName, Handler](const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
                 {
-                    return HandleGetSceneInfo(Request, OnComplete);
+                    return AdmitRequest(RouteName, Request, OnComplete, Handler);
                 }
             ));
-
-        UE_LOG(LogTemp, Warning, TEXT("HTTP routes configured"));
     }
 
-    // 単一アクター作成の処理を分離
-    AActor* CreateSingleActor(const TSharedPtr<FJsonObject>& ActorJson, UWorld* World)
+    // クライアント識別子。同一ホストの複数クライアントを区別できるようX-Client-Idを優先する
+    static FString GetClientId(const FHttpServerRequest& Request)
     {
-        if (!ActorJson.IsValid() || !World) return nullptr;
-
-        FString ActorType = ActorJson->GetStringField(TEXT("type"));
-        FString ActorName = ActorJson->GetStringField(TEXT("name"));
-        
-        TSharedPtr<FJsonObject> LocationObj = ActorJson->GetObjectField(TEXT("location"));
-        FVector Location(
-            LocationObj->GetNumberField(TEXT("x")),
-            LocationObj->GetNumberField(TEXT("y")),
-            LocationObj->GetNumberField(TEXT("z"))
-        );
-
-        // 色情報の取得（オプション）
-        FLinearColor Color = FLinearColor::White;
-        if (ActorJson->HasField(TEXT("color")))
+        const TArray<FString>* ClientIdHeader = Request.Headers.Find(TEXT("X-Client-Id"));
+        if (ClientIdHeader && ClientIdHeader->Num() > 0)
         {
-            TSharedPtr<FJsonObject> ColorObj = ActorJson->GetObjectField(TEXT("color"));
-            Color = FLinearColor(
-                ColorObj->GetNumberField(TEXT("r")),
-                ColorObj->GetNumberField(TEXT("g")),
-                ColorObj->GetNumberField(TEXT("b")),
-                ColorObj->HasField(TEXT("a")) ? ColorObj->GetNumberField(TEXT("a")) : 1.0f
-            );
+            return (*ClientIdHeader)[0];
         }
 
-        // スケール情報の取得（オプション）
-        FVector Scale = FVector(1.0f, 1.0f, 1.0f);
-        if (ActorJson->HasField(TEXT("scale")))
+        if (Request.PeerAddress.IsValid())
         {
-            TSharedPtr<FJsonObject> ScaleObj = ActorJson->GetObjectField(TEXT("scale"));
-            if (ScaleObj->HasField(TEXT("uniform")))
-            {
-                float UniformScale = ScaleObj->GetNumberField(TEXT("uniform"));
-                Scale = FVector(UniformScale, UniformScale, UniformScale);
-            }
-            else
-            {
-                Scale = FVector(
-                    ScaleObj->HasField(TEXT("x")) ? ScaleObj->GetNumberField(TEXT("x")) : 1.0f,
-                    ScaleObj->HasField(TEXT("y")) ? ScaleObj->GetNumberField(TEXT("y")) : 1.0f,
-                    ScaleObj->HasField(TEXT("z")) ? ScaleObj->GetNumberField(TEXT("z")) : 1.0f
-                );
-            }
+            return Request.PeerAddress->ToString(false);
         }
 
-        // サイズ情報（dimensions）の取得（オプション）
-        FVector Dimensions;
-        bool bHasDimensions = false;
-        if (ActorJson->HasField(TEXT("dimensions")))
-        {
-            TSharedPtr<FJsonObject> DimensionsObj = ActorJson->GetObjectField(TEXT("dimensions"));
-            Dimensions = FVector(
-                DimensionsObj->GetNumberField(TEXT("width")),
-                DimensionsObj->GetNumberField(TEXT("depth")),
-                DimensionsObj->GetNumberField(TEXT("height"))
-            );
-            bHasDimensions = true;
-        }
+        return TEXT("anonymous");
+    }
 
-        AActor* NewActor = nullptr;
-        
-        if (ActorType == TEXT("Cube") || ActorType == TEXT("Sphere") || 
-            ActorType == TEXT("Cylinder") || ActorType == TEXT("Plane"))
+    static double GetFrameBudgetSeconds()
+    {
+        return CVarFrameBudgetMs.GetValueOnGameThread() / 1000.0;
+    }
+
+    // リクエストの受付。空いていれば即時実行し、混雑時は上限付きの待ち行列に積む
+    bool AdmitRequest(FName Route, const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete, FRequestHandler Handler)
+    {
+        // X-Deadline-Ms: 受信時点からの残り時間（ミリ秒）。過ぎたリクエストは実行せずに捨てる
+        double Deadline = 0.0;
+        const TArray<FString>* DeadlineHeader = Request.Headers.Find(TEXT("X-Deadline-Ms"));
+        if (DeadlineHeader && DeadlineHeader->Num() > 0)
         {
-            AStaticMeshActor* MeshActor = World->SpawnActor<AStaticMeshActor>(Location, FRotator::ZeroRotator);
-            
-            if (MeshActor)
+            // 数値として読めない値は期限切れと区別して400にする
+            double DeadlineMs = 0.0;
+            if (!LexTryParseString(DeadlineMs, *(*DeadlineHeader)[0].TrimStartAndEnd()))
             {
-                FString MeshPath;
-                FVector BaseScale = Scale;
-                
-                if (ActorType == TEXT("Cube"))
-                {
-                    MeshPath = TEXT("/Engine/BasicShapes/Cube.Cube");
-                    if (bHasDimensions)
-                    {
-                        // Cubeの基本サイズは100x100x100
-                        BaseScale.X *= Dimensions.X / 100.0f;
-                        BaseScale.Y *= Dimensions.Y / 100.0f;
-                        BaseScale.Z *= Dimensions.Z / 100.0f;
-                    }
-                }
-                else if (ActorType == TEXT("Sphere"))
-                {
-                    MeshPath = TEXT("/Engine/BasicShapes/Sphere.Sphere");
-                    if (bHasDimensions)
-                    {
-                        // Sphereの基本直径は100
-                        float AvgDimension = (Dimensions.X + Dimensions.Y + Dimensions.Z) / 3.0f;
-                        BaseScale *= AvgDimension / 100.0f;
-                    }
-                }
-                else if (ActorType == TEXT("Cylinder"))
-                {
-                    MeshPath = TEXT("/Engine/BasicShapes/Cylinder.Cylinder");
-                    if (bHasDimensions)
-                    {
-                        // Cylinderの基本サイズは直径100、高さ200
-                        BaseScale.X *= Dimensions.X / 100.0f;
-                        BaseScale.Y *= Dimensions.Y / 100.0f;
-                        BaseScale.Z *= Dimensions.Z / 200.0f;
-                    }
-                }
-                else if (ActorType == TEXT("Plane"))
-                {
-                    MeshPath = TEXT("/Engine/BasicShapes/Plane.Plane");
-                    if (bHasDimensions)
-                    {
-                        // Planeの基本サイズは100x100
-                        BaseScale.X *= Dimensions.X / 100.0f;
-                        BaseScale.Y *= Dimensions.Y / 100.0f;
-                    }
-                }
-                
-                UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *MeshPath);
-                if (Mesh)
-                {
-                    MeshActor->GetStaticMeshComponent()->SetStaticMesh(Mesh);
-                    
-                    // マテリアルの設定
-                    UMaterial* BaseMaterial = LoadObject<UMaterial>(nullptr, TEXT("/Engine/BasicShapes/BasicShapeMaterial.BasicShapeMaterial"));
-                    if (BaseMaterial)
-                    {
-                        UMaterialInstanceDynamic* DynMaterial = UMaterialInstanceDynamic::Create(BaseMaterial, MeshActor);
-                        DynMaterial->SetVectorParameterValue(TEXT("Color"), Color);
-                        MeshActor->GetStaticMeshComponent()->SetMaterial(0, DynMaterial);
-                    }
-                }
-                
-                // スケールの設定
-                MeshActor->SetActorScale3D(BaseScale);
-                
-                NewActor = MeshActor;
+                SendErrorResponse(OnComplete, TEXT("Invalid X-Deadline-Ms"));
+                return true;
             }
-        }
-        else if (ActorType == TEXT("Light"))
-        {
-            APointLight* LightActor = World->SpawnActor<APointLight>(Location, FRotator::ZeroRotator);
-            if (LightActor)
+            if (DeadlineMs <= 0.0)
             {
-                UPointLightComponent* LightComponent = LightActor->PointLightComponent;
-                if (LightComponent)
-                {
-                    LightComponent->SetLightColor(Color);
-                    
-                    if (ActorJson->HasField(TEXT("intensity")))
-                    {
-                        float Intensity = ActorJson->GetNumberField(TEXT("intensity"));
-                        LightComponent->SetIntensity(Intensity);
-                    }
-                    
-                    if (ActorJson->HasField(TEXT("attenuationRadius")))
-                    {
-                        float Radius = ActorJson->GetNumberField(TEXT("attenuationRadius"));
-                        LightComponent->SetAttenuationRadius(Radius);
-                    }
-                }
-                NewActor = LightActor;
+                SendErrorResponse(OnComplete, TEXT("Request deadline exceeded"), 504);
+                return true;
             }
-        }
-        else if (ActorType == TEXT("Camera"))
-        {
-            NewActor = World->SpawnActor<ACameraActor>(Location, FRotator::ZeroRotator);
+            Deadline = FPlatformTime::Seconds() + DeadlineMs / 1000.0;
         }
 
-        if (NewActor)
+        // 待ちが無くフレーム予算も残っていれば、遅延を増やさないようその場で処理
+        if (QueuedRequestCount == 0 && FrameWorkSeconds < GetFrameBudgetSeconds())
         {
-            NewActor->SetActorLabel(ActorName);
+            ExecuteRequest(Handler, Request, OnComplete);
+            return true;
         }
 
-        return NewActor;
-    }
+        const FString ClientId = GetClientId(Request);
+        FClientQueue* ClientQueue = ClientQueues.FindByPredicate(
+            [&ClientId](const FClientQueue& Queue) { return Queue.ClientId == ClientId; });
 
-    bool HandleCreateActor(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
-    {
-        TSharedPtr<FJsonObject> JsonBody = ParseJsonBody(Request);
-        if (!JsonBody.IsValid())
+        int32& RouteCount = QueuedPerRoute.FindOrAdd(Route);
+        const int32 ClientCount = ClientQueue ? ClientQueue->Pending.Num() : 0;
+        if (RouteCount >= CVarMaxQueuedPerRoute.GetValueOnGameThread() ||
+            ClientCount >= CVarMaxQueuedPerClient.GetValueOnGameThread())
         {
-            SendErrorResponse(OnComplete, TEXT("Invalid JSON"));
+            UE_LOG(LogTemp, Warning, TEXT("Rejected request %s from %s (queue full)"), *Route.ToString(), *ClientId);
+            SendTooManyRequestsResponse(OnComplete);
             return true;
         }
 
-        UWorld* World = GetGameWorld();
-        if (!World)
+        if (!ClientQueue)
         {
-            SendErrorResponse(OnComplete, TEXT("No active world"));
-            return true;
+            ClientQueue = &ClientQueues.AddDefaulted_GetRef();
+            ClientQueue->ClientId = ClientId;
         }
 
-        AActor* NewActor = CreateSingleActor(JsonBody, World);
+        FPendingRequest& Pending = ClientQueue->Pending.AddDefaulted_GetRef();
+        Pending.Request = MakeShared<FHttpServerRequest>(Request);
+        Pending.OnComplete = OnComplete;
+        Pending.Handler = Handler;
+        Pending.Route = Route;
+        Pending.Deadline = Deadline;
 
-        if (NewActor)
+        ++RouteCount;
+        ++QueuedRequestCount;
+        return true;
+    }
+
+    void ExecuteRequest(FRequestHandler Handler, const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    {
+        const double StartTime = FPlatformTime::Seconds();
+
+        // 対象ワールドの指定が無ければ従来どおり既定のワールドで実行する
+        FString WorldSpec;
+        if (!GetWorldSpec(Request, WorldSpec))
         {
-            UE_LOG(LogTemp, Warning, TEXT("Created actor: %s"), *NewActor->GetActorLabel());
-            
-            TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
-            ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
-            ResponseJson->SetStringField(TEXT("actorId"), NewActor->GetName());
-            
-            SendJsonResponse(OnComplete, ResponseJson);
+            (this->*Handler)(Request, OnComplete);
         }
         else
         {
-            SendErrorResponse(OnComplete, TEXT("Failed to create actor"));
+            TArray<FTargetWorld, TInlineAllocator<4>> Targets;
+            if (!ResolveTargetWorlds(WorldSpec, Targets))
+            {
+                SendErrorResponse(OnComplete, FString::Printf(TEXT("World not found: %s"), *WorldSpec), 404);
+            }
+            else if (Targets.Num() == 1 && WorldSpec != TEXT("all"))
+            {
+                TGuardValue<UWorld*> WorldGuard(CurrentWorld, Targets[0].World.Get());
+                (this->*Handler)(Request, OnComplete);
+            }
+            else if (IsGlobalIdRoute(Handler))
+            {
+                SendErrorResponse(OnComplete, TEXT("Multiple target worlds are not supported for this route"));
+            }
+            else
+            {
+                ExecuteFanOut(Handler, Request, OnComplete, Targets);
+            }
         }
 
-        return true;
+        FrameWorkSeconds += FPlatformTime::Seconds() - StartTime;
     }
 
-    bool HandleCreateActorsBatch(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    // グループやインポートのIDはワールドをまたいで1つなので、ファンアウトすると同じ対象を何度も操作してしまう
+    static bool IsGlobalIdRoute(FRequestHandler Handler)
     {
-        TSharedPtr<FJsonObject> JsonBody = ParseJsonBody(Request);
-        if (!JsonBody.IsValid())
+        return Handler == &UE5HTTPServer::HandleGetGroup ||
+            Handler == &UE5HTTPServer::HandleTranslateGroup ||
+            Handler == &UE5HTTPServer::HandleRotateGroup ||
+            Handler == &UE5HTTPServer::HandleSetGroupColor ||
+            Handler == &UE5HTTPServer::HandleSetGroupScale ||
+            Handler == &UE5HTTPServer::HandleDeleteGroup ||
+            Handler == &UE5HTTPServer::HandleImportChunk ||
+            Handler == &UE5HTTPServer::HandleGetImport ||
+            Handler == &UE5HTTPServer::HandleCancelImport;
+    }
+
+    // X-Worldヘッダーか?world=で対象ワールドを指定する（"editor"、"pie"、"pie:1"、コンテキスト名、"all"、カンマ区切り）
+    static bool GetWorldSpec(const FHttpServerRequest& Request, FString& OutWorldSpec)
+    {
+        const TArray<FString>* WorldHeader = Request.Headers.Find(TEXT("X-World"));
+        if (WorldHeader && WorldHeader->Num() > 0)
         {
-            SendErrorResponse(OnComplete, TEXT("Invalid JSON"));
-            return true;
+            OutWorldSpec = (*WorldHeader)[0];
+        }
+        else if (const FString* WorldParam = Request.QueryParams.Find(TEXT("world")))
+        {
+            OutWorldSpec = *WorldParam;
         }
 
-        UWorld* World = GetGameWorld();
-        if (!World)
+        OutWorldSpec.TrimStartAndEndInline();
+        return !OutWorldSpec.IsEmpty();
+    }
+
+    // 同じリクエストを各ワールドで実行し、ワールドごとの結果をまとめて返す
+    void ExecuteFanOut(FRequestHandler Handler, const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete, TConstArrayView<FTargetWorld> Targets)
+    {
+        TSharedRef<FFanOutState> State = MakeShared<FFanOutState>();
+        State->OnComplete = OnComplete;
+        State->Results.SetNum(Targets.Num());
+        State->Remaining = Targets.Num();
+        for (const FTargetWorld& Target : Targets)
         {
-            SendErrorResponse(OnComplete, TEXT("No active world"));
-            return true;
+            State->WorldNames.Add(Target.Name);
         }
 
-        TArray<TSharedPtr<FJsonValue>> ActorsArray = JsonBody->GetArrayField(TEXT("actors"));
-        TArray<FString> CreatedActorIds;
-        int32 SuccessCount = 0;
-        int32 FailCount = 0;
+        // 本体はワールドの数だけ解析し直さず、最初に1回だけ解析して使い回す
+        TGuardValue<TSharedPtr<FJsonObject>> BodyGuard(PreparsedBody, ParseJsonBody(Request));
 
-        for (const TSharedPtr<FJsonValue>& ActorValue : ActorsArray)
+        for (int32 Index = 0; Index < Targets.Num(); ++Index)
         {
-            TSharedPtr<FJsonObject> ActorObj = ActorValue->AsObject();
-            AActor* NewActor = CreateSingleActor(ActorObj, World);
-            
-            if (NewActor)
+            UWorld* World = Targets[Index].World.Get();
+            TGuardValue<UWorld*> WorldGuard(CurrentWorld, World);
+
+            (this->*Handler)(Request, [State, Index](TUniquePtr<FHttpServerResponse>&& Response)
             {
-                CreatedActorIds.Add(NewActor->GetName());
+                FBatchOperationResult& Result = State->Results[Index];
+                Result.bCompleted = true;
+                Result.StatusCode = static_cast<int32>(Response->Code);
+                Result.Body = MoveTemp(Response->Body);
+
+                if (--State->Remaining == 0)
+                {
+                    SendFanOutResponse(*State);
+                }
+            });
+        }
+    }
+
+    static void SendFanOutResponse(FFanOutState& State)
+    {
+        int32 ResultsSize = 0;
+        int32 FailedCount = 0;
+        for (const FBatchOperationResult& Result : State.Results)
+        {
+            ResultsSize += Result.Body.Num() + 64;
+            FailedCount += Result.StatusCode >= 400 ? 1 : 0;
+        }
+
+        FJsonResponseWriter Writer(64 + ResultsSize);
+        Writer.BeginObject();
+        Writer.StringField("status", FailedCount == 0 ? TEXT("success") : TEXT("partial"));
+        Writer.IntField("failed", FailedCount);
+        Writer.Key("worlds");
+        Writer.BeginArray();
+        for (int32 Index = 0; Index < State.Results.Num(); ++Index)
+        {
+            const FBatchOperationResult& Result = State.Results[Index];
+            Writer.BeginObject();
+            Writer.StringField("world", State.WorldNames[Index]);
+            Writer.IntField("status", Result.StatusCode);
+            Writer.Key("body");
+            if (Result.Body.Num() > 0)
+            {
+                Writer.RawValue(Result.Body);
+            }
+            else
+            {
+                Writer.Null();
+            }
+            Writer.EndObject();
+        }
+        Writer.EndArray();
+        Writer.EndObject();
+
+        State.OnComplete(CreateJsonResponse(Writer.Finish(), 200));
+    }
+
+    // 指定に一致するワールドを集める。1つでも見つからない名前があればfalse
+    bool ResolveTargetWorlds(const FString& WorldSpec, TArray<FTargetWorld, TInlineAllocator<4>>& OutTargets)
+    {
+        RefreshTargetWorlds();
+
+        TArray<FString> Names;
+        WorldSpec.ParseIntoArray(Names, TEXT(","), true);
+
+        for (FString& Name : Names)
+        {
+            Name.TrimStartAndEndInline();
+            const bool bAll = Name == TEXT("all");
+            const bool bFirstPIE = Name == TEXT("pie");
+
+            bool bFound = false;
+            for (const FTargetWorld& Target : TargetWorlds)
+            {
+                UWorld* World = Target.World.Get();
+                if (!World)
+                {
+                    continue;
+                }
+
+                if (bAll || (bFirstPIE && Target.WorldType == EWorldType::PIE) ||
+                    Name == Target.Name || Name == Target.ContextHandle.ToString())
+                {
+                    bFound = true;
+                    if (!OutTargets.ContainsByPredicate([World](const FTargetWorld& Added) { return Added.World.Get() == World; }))
+                    {
+                        OutTargets.Add(Target);
+                    }
+
+                    if (!bAll)
+                    {
+                        break;
+                    }
+                }
+            }
+
+            if (!bFound)
+            {
+                return false;
+            }
+        }
+
+        return OutTargets.Num() > 0;
+    }
+
+    void RefreshTargetWorlds()
+    {
+        if (!bTargetWorldsDirty)
+        {
+            return;
+        }
+        bTargetWorldsDirty = false;
+        TargetWorlds.Reset();
+
+        if (!GEngine)
+        {
+            return;
+        }
+
+        for (const FWorldContext& Context : GEngine->GetWorldContexts())
+        {
+            UWorld* World = Context.World();
+            if (!World)
+            {
+                continue;
+            }
+
+            FString Name;
+            switch (Context.WorldType)
+            {
+            case EWorldType::PIE:    Name = FString::Printf(TEXT("pie:%d"), Context.PIEInstance); break;
+            case EWorldType::Editor: Name = TEXT("editor"); break;
+            case EWorldType::Game:   Name = TEXT("game"); break;
+            default:                 continue;
+            }
+
+            FTargetWorld& Target = TargetWorlds.AddDefaulted_GetRef();
+            Target.Name = MoveTemp(Name);
+            Target.ContextHandle = Context.ContextHandle;
+            Target.World = World;
+            Target.WorldType = Context.WorldType;
+        }
+    }
+
+    void OnWorldInitialized(UWorld* World, const UWorld::InitializationValues InitializationValues)
+    {
+        bTargetWorldsDirty = true;
+    }
+
+    void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+    {
+        bTargetWorldsDirty = true;
+    }
+
+    void OnPIEChanged(const bool bIsSimulating)
+    {
+        bTargetWorldsDirty = true;
+    }
+
+    // 待ち行列をクライアント間でラウンドロビンしながら、フレーム予算の範囲で処理する
+    bool TickRequestQueue(float DeltaTime)
+    {
+        DispatchLocalCommands();
+
+        const double Budget = GetFrameBudgetSeconds();
+
+        while (QueuedRequestCount > 0 && FrameWorkSeconds < Budget)
+        {
+            RoundRobinIndex %= ClientQueues.Num();
+            FClientQueue& ClientQueue = ClientQueues[RoundRobinIndex];
+
+            FPendingRequest Pending = MoveTemp(ClientQueue.Pending[0]);
+            ClientQueue.Pending.RemoveAt(0);
+
+            // 空になったクライアントは外す（次のクライアントが同じ位置に詰まる）
+            if (ClientQueue.Pending.Num() == 0)
+            {
+                ClientQueues.RemoveAt(RoundRobinIndex);
+            }
+            else
+            {
+                ++RoundRobinIndex;
+            }
+
+            --QueuedRequestCount;
+            --QueuedPerRoute.FindChecked(Pending.Route);
+
+            if (Pending.Deadline > 0.0 && FPlatformTime::Seconds() > Pending.Deadline)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("Dropped expired request %s"), *Pending.Route.ToString());
+                SendErrorResponse(Pending.OnComplete, TEXT("Request deadline exceeded"), 504);
+                continue;
+            }
+
+            ExecuteRequest(Pending.Handler, *Pending.Request, Pending.OnComplete);
+        }
+
+        FrameWorkSeconds = 0.0;
+        return true;
+    }
+
+    static const TCHAR* VerbToString(EHttpServerRequestVerbs Verb)
+    {
+        switch (Verb)
+        {
+        case EHttpServerRequestVerbs::VERB_GET:     return TEXT("GET");
+        case EHttpServerRequestVerbs::VERB_POST:    return TEXT("POST");
+        case EHttpServerRequestVerbs::VERB_PUT:     return TEXT("PUT");
+        case EHttpServerRequestVerbs::VERB_PATCH:   return TEXT("PATCH");
+        case EHttpServerRequestVerbs::VERB_DELETE:  return TEXT("DELETE");
+        case EHttpServerRequestVerbs::VERB_OPTIONS: return TEXT("OPTIONS");
+        default:                                    return TEXT("NONE");
+        }
+    }
+
+    static EHttpServerRequestVerbs ParseVerb(const FString& Verb)
+    {
+        if (Verb == TEXT("GET"))     return EHttpServerRequestVerbs::VERB_GET;
+        if (Verb == TEXT("POST"))    return EHttpServerRequestVerbs::VERB_POST;
+        if (Verb == TEXT("PUT"))     return EHttpServerRequestVerbs::VERB_PUT;
+        if (Verb == TEXT("PATCH"))   return EHttpServerRequestVerbs::VERB_PATCH;
+        if (Verb == TEXT("DELETE"))  return EHttpServerRequestVerbs::VERB_DELETE;
+        if (Verb == TEXT("OPTIONS")) return EHttpServerRequestVerbs::VERB_OPTIONS;
+        return EHttpServerRequestVerbs::VERB_NONE;
+    }
+
+    // ルート表からパスに一致するルートを探し、パスパラメータを取り出す
+    const FRouteEntry* MatchRoute(EHttpServerRequestVerbs Verb, const FString& Path, TMap<FString, FString>& OutPathParams) const
+    {
+        TArray<FString> Segments;
+        Path.ParseIntoArray(Segments, TEXT("/"), true);
+
+        for (const FRouteEntry& Route : Routes)
+        {
+            if (Route.Verb != Verb || Route.Segments.Num() != Segments.Num())
+            {
+                continue;
+            }
+
+            bool bMatched = true;
+            for (int32 Index = 0; Index < Segments.Num() && bMatched; ++Index)
+            {
+                bMatched = Route.Segments[Index].StartsWith(TEXT(":")) || Route.Segments[Index] == Segments[Index];
+            }
+
+            if (bMatched)
+            {
+                for (int32 Index = 0; Index < Segments.Num(); ++Index)
+                {
+                    if (Route.Segments[Index].StartsWith(TEXT(":")))
+                    {
+                        OutPathParams.Add(Route.Segments[Index].RightChop(1), Segments[Index]);
+                    }
+                }
+                return &Route;
+            }
+        }
+
+        return nullptr;
+    }
+
+    // ローカル転送で届いたコマンドをHTTPと同じ受付制御・ハンドラーへ流す
+    void DispatchLocalCommands()
+    {
+        if (!LocalTransport)
+        {
+            return;
+        }
+
+        FLocalCommand Command;
+        while (LocalTransport->DequeueCommand(Command))
+        {
+            TSharedPtr<FLocalConnection, ESPMode::ThreadSafe> Connection = Command.Connection;
+            const uint32 RequestId = Command.RequestId;
+            FHttpResultCallback OnComplete = [Connection, RequestId](TUniquePtr<FHttpServerResponse>&& Response)
+            {
+                Connection->SendResponse(RequestId, static_cast<int32>(Response->Code), MoveTemp(Response->Body));
+            };
+
+            FHttpServerRequest Request;
+            FString Path;
+            SplitPathAndQuery(Command.Path, Path, Request.QueryParams);
+            Request.Verb = ParseVerb(Command.Verb);
+            Request.RelativePath = FHttpPath(Path);
+            Request.Body = MoveTemp(Command.Body);
+            Request.Headers.Add(TEXT("X-Client-Id"), { FString::Printf(TEXT("local-%d"), Connection->GetId()) });
+
+            if (Request.Verb == EHttpServerRequestVerbs::VERB_GET && Path == TEXT("/health"))
+            {
+                SendPreencodedResponse(OnComplete, HealthOkBody);
+                continue;
+            }
+
+            const FRouteEntry* Route = MatchRoute(Request.Verb, Path, Request.PathParams);
+            if (!Route)
+            {
+                SendErrorResponse(OnComplete, TEXT("Route not found"), 404);
+                continue;
+            }
+
+            AdmitRequest(Route->Name, Request, OnComplete, Route->Handler);
+        }
+    }
+
+    // "パス?key=value&..."をパスとクエリパラメータに分ける（ローカル転送と/batchの操作で共通）
+    static void SplitPathAndQuery(const FString& Target, FString& OutPath, TMap<FString, FString>& OutQueryParams)
+    {
+        FString Query;
+        if (!Target.Split(TEXT("?"), &OutPath, &Query))
+        {
+            OutPath = Target;
+            return;
+        }
+
+        TArray<FString> QueryPairs;
+        Query.ParseIntoArray(QueryPairs, TEXT("&"), true);
+        for (const FString& Pair : QueryPairs)
+        {
+            FString Key;
+            FString Value;
+            if (Pair.Split(TEXT("="), &Key, &Value))
+            {
+                OutQueryParams.Add(Key, Value);
+            }
+        }
+    }
+
+    // 単一アクター作成の処理を分離
+    AActor* CreateSingleActor(const TSharedPtr<FJsonObject>& ActorJson, UWorld* World, const FSpawnProfile* DefaultProfile = nullptr)
+    {
+        FActorSpawnDesc Desc;
+        if (!World || !ReadActorSpawnDesc(ActorJson, Desc)) return nullptr;
+
+        return SpawnActorFromDesc(Desc, World, DefaultProfile);
+    }
+
+    // 読み取り済みの作成内容からアクターを作る（JSONとインポートのレコードで共通）
+    AActor* SpawnActorFromDesc(const FActorSpawnDesc& Desc, UWorld* World, const FSpawnProfile* DefaultProfile = nullptr)
+    {
+        const FString& ActorType = Desc.Type;
+        const FString& ActorName = Desc.Name;
+        const FVector& Location = Desc.Location;
+        const FLinearColor& Color = Desc.Color;
+        const FVector& Scale = Desc.Scale;
+        const FVector& Dimensions = Desc.Dimensions;
+        const bool bHasDimensions = Desc.bHasDimensions;
+
+        // スポーンプロファイル（アクター個別指定 > バッチ既定値）
+        const FSpawnProfile* Profile = Desc.ProfileName.IsEmpty() ? DefaultProfile : FindSpawnProfile(Desc.ProfileName);
+
+        AActor* NewActor = nullptr;
+        
+        if (ActorType == TEXT("Cube") || ActorType == TEXT("Sphere") || 
+            ActorType == TEXT("Cylinder") || ActorType == TEXT("Plane"))
+        {
+            FString MeshPath;
+            FVector BaseScale = Scale;
+            
+            if (ActorType == TEXT("Cube"))
+            {
+                MeshPath = TEXT("/Engine/BasicShapes/Cube.Cube");
+                if (bHasDimensions)
+                {
+                    // Cubeの基本サイズは100x100x100
+                    BaseScale.X *= Dimensions.X / 100.0f;
+                    BaseScale.Y *= Dimensions.Y / 100.0f;
+                    BaseScale.Z *= Dimensions.Z / 100.0f;
+                }
+            }
+            else if (ActorType == TEXT("Sphere"))
+            {
+                MeshPath = TEXT("/Engine/BasicShapes/Sphere.Sphere");
+                if (bHasDimensions)
+                {
+                    // Sphereの基本直径は100
+                    float AvgDimension = (Dimensions.X + Dimensions.Y + Dimensions.Z) / 3.0f;
+                    BaseScale *= AvgDimension / 100.0f;
+                }
+            }
+            else if (ActorType == TEXT("Cylinder"))
+            {
+                MeshPath = TEXT("/Engine/BasicShapes/Cylinder.Cylinder");
+                if (bHasDimensions)
+                {
+                    // Cylinderの基本サイズは直径100、高さ200
+                    BaseScale.X *= Dimensions.X / 100.0f;
+                    BaseScale.Y *= Dimensions.Y / 100.0f;
+                    BaseScale.Z *= Dimensions.Z / 200.0f;
+                }
+            }
+            else if (ActorType == TEXT("Plane"))
+            {
+                MeshPath = TEXT("/Engine/BasicShapes/Plane.Plane");
+                if (bHasDimensions)
+                {
+                    // Planeの基本サイズは100x100
+                    BaseScale.X *= Dimensions.X / 100.0f;
+                    BaseScale.Y *= Dimensions.Y / 100.0f;
+                }
+            }
+
+            // 遅延スポーン：メッシュ・マテリアル・スケール・ラベルを確定させてからFinishSpawningする
+            const FTransform SpawnTransform(FRotator::ZeroRotator, Location, BaseScale);
+            AStaticMeshActor* MeshActor = World->SpawnActorDeferred<AStaticMeshActor>(
+                AStaticMeshActor::StaticClass(), SpawnTransform, nullptr, nullptr,
+                ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+            
+            if (MeshActor)
+            {
+                UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *MeshPath);
+                if (Mesh)
+                {
+                    MeshActor->GetStaticMeshComponent()->SetStaticMesh(Mesh);
+                    
+                    // マテリアルの設定
+                    UMaterial* BaseMaterial = LoadObject<UMaterial>(nullptr, TEXT("/Engine/BasicShapes/BasicShapeMaterial.BasicShapeMaterial"));
+                    if (BaseMaterial)
+                    {
+                        UMaterialInstanceDynamic* DynMaterial = UMaterialInstanceDynamic::Create(BaseMaterial, MeshActor);
+                        DynMaterial->SetVectorParameterValue(TEXT("Color"), Color);
+                        MeshActor->GetStaticMeshComponent()->SetMaterial(0, DynMaterial);
+                    }
+                }
+
+                if (Profile)
+                {
+                    ApplySpawnProfile(MeshActor, *Profile);
+                }
+                MeshActor->SetActorLabel(ActorName, !FBulkEditScope::IsActive());
+                MeshActor->FinishSpawning(SpawnTransform);
+                
+                NewActor = MeshActor;
+            }
+        }
+        else if (ActorType == TEXT("Light"))
+        {
+            const FTransform SpawnTransform(FRotator::ZeroRotator, Location);
+            APointLight* LightActor = World->SpawnActorDeferred<APointLight>(
+                APointLight::StaticClass(), SpawnTransform, nullptr, nullptr,
+                ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+            if (LightActor)
+            {
+                UPointLightComponent* LightComponent = LightActor->PointLightComponent;
+                if (LightComponent)
+                {
+                    LightComponent->SetLightColor(Color);
+                    
+                    if (Desc.Intensity.IsSet())
+                    {
+                        LightComponent->SetIntensity(Desc.Intensity.GetValue());
+                    }
+                    
+                    if (Desc.AttenuationRadius.IsSet())
+                    {
+                        LightComponent->SetAttenuationRadius(Desc.AttenuationRadius.GetValue());
+                    }
+                }
+
+                if (Profile)
+                {
+                    ApplySpawnProfile(LightActor, *Profile);
+                }
+                LightActor->SetActorLabel(ActorName, !FBulkEditScope::IsActive());
+                LightActor->FinishSpawning(SpawnTransform);
+
+                NewActor = LightActor;
+            }
+        }
+        else if (ActorType == TEXT("Camera"))
+        {
+            NewActor = World->SpawnActor<ACameraActor>(Location, FRotator::ZeroRotator);
+            if (NewActor)
+            {
+                NewActor->SetActorLabel(ActorName, !FBulkEditScope::IsActive());
+            }
+        }
+
+        return NewActor;
+    }
+
+    // 名前からスポーンプロファイルを引く。"default"や未知の名前はnullptr（エンジン既定の設定）
+    static const FSpawnProfile* FindSpawnProfile(const FString& ProfileName)
+    {
+        for (const FSpawnProfile& Profile : SpawnProfiles)
+        {
+            if (ProfileName == Profile.Name)
+            {
+                return &Profile;
+            }
+        }
+
+        if (!ProfileName.IsEmpty() && ProfileName != TEXT("default"))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Unknown spawn profile: %s (using default)"), *ProfileName);
+        }
+        return nullptr;
+    }
+
+    // FinishSpawning前に呼び、登録時点から軽量な設定にしておく
+    static void ApplySpawnProfile(AActor* Actor, const FSpawnProfile& Profile)
+    {
+        if (!Profile.bCollision)
+        {
+            Actor->SetActorEnableCollision(false);
+        }
+
+        if (AStaticMeshActor* MeshActor = Cast<AStaticMeshActor>(Actor))
+        {
+            UStaticMeshComponent* MeshComponent = MeshActor->GetStaticMeshComponent();
+            if (!Profile.bCollision)
+            {
+                MeshComponent->SetCollisionProfileName(UCollisionProfile::NoCollision_ProfileName);
+                MeshComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+            }
+            MeshComponent->SetGenerateOverlapEvents(Profile.bGenerateOverlapEvents);
+            MeshComponent->SetCastShadow(Profile.bCastShadow);
+            MeshComponent->SetMobility(Profile.Mobility);
+        }
+        else if (APointLight* LightActor = Cast<APointLight>(Actor))
+        {
+            // モビリティは変えない。実行中に作ったStaticのライトはベイク済みの光しか出さず、照明として機能しない
+            if (UPointLightComponent* LightComponent = LightActor->PointLightComponent)
+            {
+                LightComponent->SetCastShadows(Profile.bCastShadow);
+            }
+        }
+    }
+
+    bool HandleCreateActor(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    {
+        TSharedPtr<FJsonObject> JsonBody = ParseJsonBody(Request);
+        if (!JsonBody.IsValid())
+        {
+            SendErrorResponse(OnComplete, TEXT("Invalid JSON"));
+            return true;
+        }
+
+        UWorld* World = GetGameWorld();
+        if (!World)
+        {
+            SendErrorResponse(OnComplete, TEXT("No active world"));
+            return true;
+        }
+
+        AActor* NewActor = CreateSingleActor(JsonBody, World);
+
+        if (NewActor)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Created actor: %s"), *NewActor->GetActorLabel());
+            
+            FJsonResponseWriter Writer;
+            Writer.BeginObject();
+            Writer.StringField("status", TEXT("success"));
+            Writer.StringField("actorId", NewActor->GetName());
+            Writer.EndObject();
+            
+            SendJsonResponse(OnComplete, Writer);
+        }
+        else
+        {
+            SendErrorResponse(OnComplete, TEXT("Failed to create actor"));
+        }
+
+        return true;
+    }
+
+    bool HandleCreateActorsBatch(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    {
+        TSharedPtr<FJsonObject> JsonBody = ParseJsonBody(Request);
+        if (!JsonBody.IsValid())
+        {
+            SendErrorResponse(OnComplete, TEXT("Invalid JSON"));
+            return true;
+        }
+
+        UWorld* World = GetGameWorld();
+        if (!World)
+        {
+            SendErrorResponse(OnComplete, TEXT("No active world"));
+            return true;
+        }
+
+        TArray<TSharedPtr<FJsonValue>> ActorsArray = JsonBody->GetArrayField(TEXT("actors"));
+        TArray<FString> CreatedActorIds;
+
+        // 作成したアクターはバッチ単位のグループとして登録する
+        const int32 GroupId = NextGroupId++;
+        FActorGroup& Group = ActorGroups.Add(GroupId);
+        JsonBody->TryGetStringField(TEXT("group"), Group.Name);
+        Group.Members.Reserve(ActorsArray.Num());
+
+        // バッチ全体の既定スポーンプロファイル
+        const FSpawnProfile* DefaultProfile = nullptr;
+        FString ProfileName;
+        if (JsonBody->TryGetStringField(TEXT("profile"), ProfileName))
+        {
+            DefaultProfile = FindSpawnProfile(ProfileName);
+        }
+        int32 SuccessCount = 0;
+        int32 FailCount = 0;
+
+        // エディターのワールドではアウトライナー・Undo・ダーティ化の処理をバッチの終わりにまとめる
+        FBulkEditScope BulkEdit(World);
+
+        for (const TSharedPtr<FJsonValue>& ActorValue : ActorsArray)
+        {
+            TSharedPtr<FJsonObject> ActorObj = ActorValue->AsObject();
+            AActor* NewActor = CreateSingleActor(ActorObj, World, DefaultProfile);
+            
+            if (NewActor)
+            {
+                CreatedActorIds.Add(NewActor->GetName());
+                Group.Members.Add(NewActor);
                 SuccessCount++;
             }
-            else
+            else
+            {
+                FailCount++;
+            }
+        }
+
+        UE_LOG(LogTemp, Warning, TEXT("Batch created %d actors (failed: %d)"), SuccessCount, FailCount);
+
+        // 1件も作れなかったバッチのグループは残さない
+        const bool bHasGroup = Group.Members.Num() > 0;
+        if (!bHasGroup)
+        {
+            ActorGroups.Remove(GroupId);
+        }
+
+        // アクターIDは1件あたり30バイト前後
+        FJsonResponseWriter Writer(64 + CreatedActorIds.Num() * 32);
+        Writer.BeginObject();
+        Writer.StringField("status", TEXT("success"));
+        Writer.IntField("created", SuccessCount);
+        Writer.IntField("failed", FailCount);
+        if (bHasGroup)
+        {
+            Writer.IntField("groupId", GroupId);
+        }
+        
+        Writer.Key("actorIds");
+        Writer.BeginArray();
+        for (const FString& Id : CreatedActorIds)
+        {
+            Writer.String(Id);
+        }
+        Writer.EndArray();
+        Writer.EndObject();
+        
+        SendJsonResponse(OnComplete, Writer);
+        return true;
+    }
+
+    bool HandleDeleteAllActors(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    {
+        UWorld* World = GetGameWorld();
+        if (!World)
+        {
+            SendErrorResponse(OnComplete, TEXT("No active world"));
+            return true;
+        }
+
+        int32 DeletedCount = 0;
+        TArray<AActor*> ActorsToDelete;
+
+        // まず削除対象のアクターを収集
+        for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
+        {
+            AActor* Actor = *ActorItr;
+            
+            // システムアクターは削除しない
+            if (Actor->IsA<AWorldSettings>() || 
+                Actor->GetActorLabel().IsEmpty() ||
+                Actor->GetActorLabel().Contains(TEXT("DefaultPhysicsVolume")) ||
+                Actor->GetActorLabel().Contains(TEXT("WorldPartition")) ||
+                Actor->GetActorLabel().Contains(TEXT("GameplayDebugger")) ||
+                Actor->GetActorLabel().Contains(TEXT("WorldDataLayers")) ||
+                Actor->GetActorLabel().Contains(TEXT("Brush")))
+            {
+                continue;
+            }
+            
+            ActorsToDelete.Add(Actor);
+        }
+
+        // アクターを削除（エディターのワールドではレベルの変更記録を1回にまとめる）
+        {
+            FBulkEditScope BulkEdit(World);
+            for (AActor* Actor : ActorsToDelete)
+            {
+                Actor->Destroy(false, !FBulkEditScope::IsActive());
+                DeletedCount++;
+            }
+        }
+
+        UE_LOG(LogTemp, Warning, TEXT("Deleted %d actors"), DeletedCount);
+
+        PruneEmptyGroups();
+
+        FJsonResponseWriter Writer;
+        Writer.BeginObject();
+        Writer.StringField("status", TEXT("success"));
+        Writer.IntField("deletedCount", DeletedCount);
+        Writer.EndObject();
+        
+        SendJsonResponse(OnComplete, Writer);
+        return true;
+    }
+
+    bool HandleSetActorColor(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    {
+        const FString* ActorNameParam = FindRouteParam(Request, TEXT("id"));
+        if (!ActorNameParam)
+        {
+            SendErrorResponse(OnComplete, TEXT("Invalid path"));
+            return true;
+        }
+
+        const FString& ActorName = *ActorNameParam;
+        
+        TSharedPtr<FJsonObject> JsonBody = ParseJsonBody(Request);
+        if (!JsonBody.IsValid())
+        {
+            SendErrorResponse(OnComplete, TEXT("Invalid JSON"));
+            return true;
+        }
+
+        const TSharedPtr<FJsonObject>* ColorObj = nullptr;
+        if (!JsonBody->TryGetObjectField(TEXT("color"), ColorObj))
+        {
+            SendErrorResponse(OnComplete, TEXT("Missing color"));
+            return true;
+        }
+
+        FLinearColor NewColor = ReadColor(*ColorObj);
+
+        AActor* FoundActor = FindActorByName(ActorName);
+        
+        if (FoundActor)
+        {
+            if (!SupportsColor(FoundActor))
+            {
+                SendErrorResponse(OnComplete, TEXT("Actor does not support color changes"));
+                return true;
+            }
+
+            if (TryStartTween(FoundActor, ETweenProperty::Color, ColorToTweenValue(NewColor), JsonBody))
+            {
+                SendTweenStartedResponse(OnComplete, JsonBody);
+                return true;
+            }
+
+            if (SetActorColor(FoundActor, NewColor))
+            {
+                UE_LOG(LogTemp, Warning, TEXT("Set color of actor: %s to (%f, %f, %f, %f)"), 
+                    *ActorName, NewColor.R, NewColor.G, NewColor.B, NewColor.A);
+                
+                SendPreencodedResponse(OnComplete, SuccessBody);
+            }
+            else
+            {
+                SendErrorResponse(OnComplete, TEXT("Actor does not support color changes"));
+            }
+        }
+        else
+        {
+            SendErrorResponse(OnComplete, TEXT("Actor not found"), 404);
+        }
+
+        return true;
+    }
+
+    bool HandleSetActorScale(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    {
+        const FString* ActorNameParam = FindRouteParam(Request, TEXT("id"));
+        if (!ActorNameParam)
+        {
+            SendErrorResponse(OnComplete, TEXT("Invalid path"));
+            return true;
+        }
+
+        const FString& ActorName = *ActorNameParam;
+        
+        TSharedPtr<FJsonObject> JsonBody = ParseJsonBody(Request);
+        if (!JsonBody.IsValid())
+        {
+            SendErrorResponse(OnComplete, TEXT("Invalid JSON"));
+            return true;
+        }
+
+        const TSharedPtr<FJsonObject>* ScaleObj = nullptr;
+        if (!JsonBody->TryGetObjectField(TEXT("scale"), ScaleObj))
+        {
+            SendErrorResponse(OnComplete, TEXT("Missing scale"));
+            return true;
+        }
+
+        FVector NewScale = ReadScale(*ScaleObj);
+
+        AActor* FoundActor = FindActorByName(ActorName);
+        
+        if (FoundActor)
+        {
+            if (TryStartTween(FoundActor, ETweenProperty::Scale, FVector4(NewScale, 0.0), JsonBody))
+            {
+                SendTweenStartedResponse(OnComplete, JsonBody);
+                return true;
+            }
+
+            FoundActor->SetActorScale3D(NewScale);
+            
+            UE_LOG(LogTemp, Warning, TEXT("Set scale of actor: %s to (%f, %f, %f)"), 
+                *ActorName, NewScale.X, NewScale.Y, NewScale.Z);
+            
+            SendPreencodedResponse(OnComplete, SuccessBody);
+        }
+        else
+        {
+            SendErrorResponse(OnComplete, TEXT("Actor not found"), 404);
+        }
+
+        return true;
+    }
+
+    bool HandleDeleteActor(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    {
+        const FString* ActorNameParam = FindRouteParam(Request, TEXT("id"));
+        if (!ActorNameParam)
+        {
+            SendErrorResponse(OnComplete, TEXT("Invalid path"));
+            return true;
+        }
+
+        const FString& ActorName = *ActorNameParam;
+        AActor* FoundActor = FindActorByName(ActorName);
+        
+        if (FoundActor)
+        {
+            FoundActor->Destroy();
+            
+            UE_LOG(LogTemp, Warning, TEXT("Deleted actor: %s"), *ActorName);
+            
+            SendPreencodedResponse(OnComplete, SuccessBody);
+        }
+        else
+        {
+            SendErrorResponse(OnComplete, TEXT("Actor not found"), 404);
+        }
+
+        return true;
+    }
+
+    bool HandleMoveActor(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    {
+        const FString* ActorNameParam = FindRouteParam(Request, TEXT("id"));
+        if (!ActorNameParam)
+        {
+            SendErrorResponse(OnComplete, TEXT("Invalid path"));
+            return true;
+        }
+
+        const FString& ActorName = *ActorNameParam;
+        
+        TSharedPtr<FJsonObject> JsonBody = ParseJsonBody(Request);
+        if (!JsonBody.IsValid())
+        {
+            SendErrorResponse(OnComplete, TEXT("Invalid JSON"));
+            return true;
+        }
+
+        const TSharedPtr<FJsonObject>* LocationObj = nullptr;
+        if (!JsonBody->TryGetObjectField(TEXT("location"), LocationObj))
+        {
+            SendErrorResponse(OnComplete, TEXT("Missing location"));
+            return true;
+        }
+
+        FVector NewLocation = ReadLocation(*LocationObj);
+
+        AActor* FoundActor = FindActorByName(ActorName);
+        
+        if (FoundActor)
+        {
+            if (TryStartTween(FoundActor, ETweenProperty::Location, FVector4(NewLocation, 0.0), JsonBody))
+            {
+                SendTweenStartedResponse(OnComplete, JsonBody);
+                return true;
+            }
+
+            FoundActor->SetActorLocation(NewLocation);
+            
+            UE_LOG(LogTemp, Warning, TEXT("Moved actor: %s to location (%f, %f, %f)"), 
+                *ActorName, NewLocation.X, NewLocation.Y, NewLocation.Z);
+            
+            SendPreencodedResponse(OnComplete, SuccessBody);
+        }
+        else
+        {
+            SendErrorResponse(OnComplete, TEXT("Actor not found"), 404);
+        }
+
+        return true;
+    }
+
+    bool HandleRotateActor(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    {
+        const FString* ActorNameParam = FindRouteParam(Request, TEXT("id"));
+        if (!ActorNameParam)
+        {
+            SendErrorResponse(OnComplete, TEXT("Invalid path"));
+            return true;
+        }
+
+        const FString& ActorName = *ActorNameParam;
+        
+        TSharedPtr<FJsonObject> JsonBody = ParseJsonBody(Request);
+        if (!JsonBody.IsValid())
+        {
+            SendErrorResponse(OnComplete, TEXT("Invalid JSON"));
+            return true;
+        }
+
+        const TSharedPtr<FJsonObject>* RotationObj = nullptr;
+        if (!JsonBody->TryGetObjectField(TEXT("rotation"), RotationObj))
+        {
+            SendErrorResponse(OnComplete, TEXT("Missing rotation"));
+            return true;
+        }
+
+        FRotator NewRotation = ReadRotation(*RotationObj);
+
+        AActor* FoundActor = FindActorByName(ActorName);
+        
+        if (FoundActor)
+        {
+            if (TryStartTween(FoundActor, ETweenProperty::Rotation, RotationToTweenValue(NewRotation), JsonBody))
+            {
+                SendTweenStartedResponse(OnComplete, JsonBody);
+                return true;
+            }
+
+            FoundActor->SetActorRotation(NewRotation);
+            
+            UE_LOG(LogTemp, Warning, TEXT("Rotated actor: %s to rotation (Pitch: %f, Yaw: %f, Roll: %f)"), 
+                *ActorName, NewRotation.Pitch, NewRotation.Yaw, NewRotation.Roll);
+            
+            SendPreencodedResponse(OnComplete, SuccessBody);
+        }
+        else
+        {
+            SendErrorResponse(OnComplete, TEXT("Actor not found"), 404);
+        }
+
+        return true;
+    }
+
+    bool HandlePatchActor(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    {
+        const FString* ActorNameParam = FindRouteParam(Request, TEXT("id"));
+        if (!ActorNameParam)
+        {
+            SendErrorResponse(OnComplete, TEXT("Invalid path"));
+            return true;
+        }
+
+        const FString& ActorName = *ActorNameParam;
+
+        TSharedPtr<FJsonObject> JsonBody = ParseJsonBody(Request);
+        if (!JsonBody.IsValid())
+        {
+            SendErrorResponse(OnComplete, TEXT("Invalid JSON"));
+            return true;
+        }
+
+        const TSharedPtr<FJsonObject>* PropertiesObj = nullptr;
+        if (!JsonBody->TryGetObjectField(TEXT("properties"), PropertiesObj))
+        {
+            SendErrorResponse(OnComplete, TEXT("Missing properties"));
+            return true;
+        }
+
+        AActor* FoundActor = FindActorByName(ActorName);
+        if (!FoundActor)
+        {
+            SendErrorResponse(OnComplete, TEXT("Actor not found"), 404);
+            return true;
+        }
+
+        UClass* ActorClass = FoundActor->GetClass();
+        TMap<FString, FResolvedPropertyPath>& ClassCache = PropertyPathCache.FindOrAdd(FObjectKey(ActorClass));
+
+        int32 UpdatedCount = 0;
+        TArray<TPair<const FString*, const TCHAR*>> Failures;
+
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Property : (*PropertiesObj)->Values)
+        {
+            const FResolvedPropertyPath* Resolved = ClassCache.Find(Property.Key);
+            if (!Resolved)
+            {
+                // 解決できたパスだけを記録する（クライアントが送る誤ったキーでキャッシュが増え続けないように）
+                FResolvedPropertyPath NewPath;
+                ResolvePropertyPath(ActorClass, Property.Key, NewPath);
+                if (NewPath.Chain.Num() > 0)
+                {
+                    Resolved = &ClassCache.Add(Property.Key, MoveTemp(NewPath));
+                }
+            }
+
+            if (!Resolved)
+            {
+                Failures.Emplace(&Property.Key, TEXT("Unknown property"));
+            }
+            else if (!SetPropertyValue(FoundActor, *Resolved, Property.Value))
+            {
+                Failures.Emplace(&Property.Key, TEXT("Failed to set value"));
+            }
+            else
+            {
+                ++UpdatedCount;
+            }
+        }
+
+        UE_LOG(LogTemp, Warning, TEXT("Patched actor: %s (%d properties, %d failed)"),
+            *ActorName, UpdatedCount, Failures.Num());
+
+        FJsonResponseWriter Writer;
+        Writer.BeginObject();
+        Writer.StringField("status", Failures.Num() == 0 ? TEXT("success") : TEXT("partial"));
+        Writer.IntField("updated", UpdatedCount);
+        Writer.Key("errors");
+        Writer.BeginArray();
+        for (const TPair<const FString*, const TCHAR*>& Failure : Failures)
+        {
+            Writer.BeginObject();
+            Writer.StringField("property", *Failure.Key);
+            Writer.StringField("error", Failure.Value);
+            Writer.EndObject();
+        }
+        Writer.EndArray();
+        Writer.EndObject();
+
+        SendJsonResponse(OnComplete, Writer);
+        return true;
+    }
+
+    // 名前を指定してグループを作る
+    bool HandleCreateGroup(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    {
+        TSharedPtr<FJsonObject> JsonBody = ParseJsonBody(Request);
+        if (!JsonBody.IsValid())
+        {
+            SendErrorResponse(OnComplete, TEXT("Invalid JSON"));
+            return true;
+        }
+
+        UWorld* World = GetGameWorld();
+        if (!World)
+        {
+            SendErrorResponse(OnComplete, TEXT("No active world"));
+            return true;
+        }
+
+        const TArray<TSharedPtr<FJsonValue>>* ActorNames = nullptr;
+        if (!JsonBody->TryGetArrayField(TEXT("actors"), ActorNames))
+        {
+            SendErrorResponse(OnComplete, TEXT("Missing actors"));
+            return true;
+        }
+
+        TSet<FString> NameSet;
+        NameSet.Reserve(ActorNames->Num());
+        for (const TSharedPtr<FJsonValue>& NameValue : *ActorNames)
+        {
+            NameSet.Add(NameValue->AsString());
+        }
+
+        const int32 GroupId = NextGroupId++;
+        FActorGroup& Group = ActorGroups.Add(GroupId);
+        JsonBody->TryGetStringField(TEXT("name"), Group.Name);
+        Group.Members.Reserve(NameSet.Num());
+
+        // 名前ごとに検索せず、ワールドを1回走査してまとめて解決する
+        for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
+        {
+            if (NameSet.Contains(ActorItr->GetActorLabel()) || NameSet.Contains(ActorItr->GetName()))
+            {
+                Group.Members.Add(*ActorItr);
+            }
+        }
+
+        // 該当するアクターが無ければグループを作らない
+        if (Group.Members.Num() == 0)
+        {
+            ActorGroups.Remove(GroupId);
+            SendErrorResponse(OnComplete, TEXT("No matching actors"), 404);
+            return true;
+        }
+
+        UE_LOG(LogTemp, Warning, TEXT("Created group %d with %d actors"), GroupId, Group.Members.Num());
+
+        SendGroupResponse(OnComplete, GroupId, Group.Members.Num());
+        return true;
+    }
+
+    bool HandleGetGroup(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    {
+        int32 GroupId = 0;
+        FActorGroup* Group = FindGroup(Request, GroupId, OnComplete);
+        if (!Group)
+        {
+            return true;
+        }
+
+        FJsonResponseWriter Writer(64 + Group->Members.Num() * 32);
+        Writer.BeginObject();
+        Writer.IntField("groupId", GroupId);
+        Writer.StringField("name", Group->Name);
+        Writer.Key("actorIds");
+        Writer.BeginArray();
+        for (const TWeakObjectPtr<AActor>& Member : Group->Members)
+        {
+            if (AActor* Actor = Member.Get())
+            {
+                Writer.String(Actor->GetName());
+            }
+        }
+        Writer.EndArray();
+        Writer.EndObject();
+
+        SendJsonResponse(OnComplete, Writer);
+        return true;
+    }
+
+    bool HandleTranslateGroup(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    {
+        int32 GroupId = 0;
+        TSharedPtr<FJsonObject> JsonBody;
+        FActorGroup* Group = FindGroupWithBody(Request, GroupId, JsonBody, OnComplete);
+        if (!Group)
+        {
+            return true;
+        }
+
+        const TSharedPtr<FJsonObject>* DeltaObj = nullptr;
+        if (!JsonBody->TryGetObjectField(TEXT("delta"), DeltaObj))
+        {
+            SendErrorResponse(OnComplete, TEXT("Missing delta"));
+            return true;
+        }
+
+        const FVector Delta = ReadLocation(*DeltaObj);
+
+        const int32 Affected = ForEachGroupMember(*Group, [&Delta](AActor* Actor)
+        {
+            Actor->AddActorWorldOffset(Delta);
+        });
+
+        SendGroupResponse(OnComplete, GroupId, Affected);
+        return true;
+    }
+
+    // ピボット（省略時はメンバーの重心）を中心に回転する
+    bool HandleRotateGroup(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    {
+        int32 GroupId = 0;
+        TSharedPtr<FJsonObject> JsonBody;
+        FActorGroup* Group = FindGroupWithBody(Request, GroupId, JsonBody, OnComplete);
+        if (!Group)
+        {
+            return true;
+        }
+
+        const TSharedPtr<FJsonObject>* RotationObj = nullptr;
+        if (!JsonBody->TryGetObjectField(TEXT("rotation"), RotationObj))
+        {
+            SendErrorResponse(OnComplete, TEXT("Missing rotation"));
+            return true;
+        }
+
+        const FQuat DeltaRotation = ReadRotation(*RotationObj).Quaternion();
+
+        FVector Pivot = FVector::ZeroVector;
+        const TSharedPtr<FJsonObject>* PivotObj = nullptr;
+        if (JsonBody->TryGetObjectField(TEXT("pivot"), PivotObj))
+        {
+            Pivot = ReadLocation(*PivotObj);
+        }
+        else
+        {
+            int32 MemberCount = 0;
+            ForEachGroupMember(*Group, [&Pivot, &MemberCount](AActor* Actor)
+            {
+                Pivot += Actor->GetActorLocation();
+                ++MemberCount;
+            });
+            Pivot /= FMath::Max(MemberCount, 1);
+        }
+
+        const int32 Affected = ForEachGroupMember(*Group, [&DeltaRotation, &Pivot](AActor* Actor)
+        {
+            const FVector NewLocation = Pivot + DeltaRotation.RotateVector(Actor->GetActorLocation() - Pivot);
+            const FQuat NewRotation = DeltaRotation * Actor->GetActorQuat();
+            Actor->SetActorLocationAndRotation(NewLocation, NewRotation);
+        });
+
+        SendGroupResponse(OnComplete, GroupId, Affected);
+        return true;
+    }
+
+    bool HandleSetGroupColor(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    {
+        int32 GroupId = 0;
+        TSharedPtr<FJsonObject> JsonBody;
+        FActorGroup* Group = FindGroupWithBody(Request, GroupId, JsonBody, OnComplete);
+        if (!Group)
+        {
+            return true;
+        }
+
+        const TSharedPtr<FJsonObject>* ColorObj = nullptr;
+        if (!JsonBody->TryGetObjectField(TEXT("color"), ColorObj))
+        {
+            SendErrorResponse(OnComplete, TEXT("Missing color"));
+            return true;
+        }
+
+        const FLinearColor NewColor = ReadColor(*ColorObj);
+
+        const int32 Affected = ForEachGroupMember(*Group, [this, &NewColor](AActor* Actor)
+        {
+            SetActorColor(Actor, NewColor);
+        });
+
+        SendGroupResponse(OnComplete, GroupId, Affected);
+        return true;
+    }
+
+    bool HandleSetGroupScale(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    {
+        int32 GroupId = 0;
+        TSharedPtr<FJsonObject> JsonBody;
+        FActorGroup* Group = FindGroupWithBody(Request, GroupId, JsonBody, OnComplete);
+        if (!Group)
+        {
+            return true;
+        }
+
+        const TSharedPtr<FJsonObject>* ScaleObj = nullptr;
+        if (!JsonBody->TryGetObjectField(TEXT("scale"), ScaleObj))
+        {
+            SendErrorResponse(OnComplete, TEXT("Missing scale"));
+            return true;
+        }
+
+        const FVector NewScale = ReadScale(*ScaleObj);
+
+        const int32 Affected = ForEachGroupMember(*Group, [&NewScale](AActor* Actor)
+        {
+            Actor->SetActorScale3D(NewScale);
+        });
+
+        SendGroupResponse(OnComplete, GroupId, Affected);
+        return true;
+    }
+
+    // メンバーのアクターを削除し、グループも破棄する
+    bool HandleDeleteGroup(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    {
+        int32 GroupId = 0;
+        FActorGroup* Group = FindGroup(Request, GroupId, OnComplete);
+        if (!Group)
+        {
+            return true;
+        }
+
+        FBulkEditScope BulkEdit(GetGameWorld());
+        const int32 Affected = ForEachGroupMember(*Group, [](AActor* Actor)
+        {
+            Actor->Destroy(false, !FBulkEditScope::IsActive());
+        });
+
+        // 別のワールドのメンバーが残っている間はグループを残す（空になればSendGroupResponseで外れる）
+        UE_LOG(LogTemp, Warning, TEXT("Deleted group %d (%d actors)"), GroupId, Affected);
+
+        SendGroupResponse(OnComplete, GroupId, Affected);
+        return true;
+    }
+
+    FActorGroup* FindGroup(const FHttpServerRequest& Request, int32& OutGroupId, const FHttpResultCallback& OnComplete)
+    {
+        if (!TryGetRouteParam(Request, TEXT("id"), OutGroupId))
+        {
+            SendErrorResponse(OnComplete, TEXT("Invalid group id"));
+            return nullptr;
+        }
+
+        // 削除済みのメンバーを詰め、空になっていればここで外す
+        FActorGroup* Group = RemoveGroupIfEmpty(OutGroupId) ? nullptr : ActorGroups.Find(OutGroupId);
+        if (!Group)
+        {
+            SendErrorResponse(OnComplete, TEXT("Group not found"), 404);
+        }
+        return Group;
+    }
+
+    FActorGroup* FindGroupWithBody(const FHttpServerRequest& Request, int32& OutGroupId, TSharedPtr<FJsonObject>& OutJsonBody, const FHttpResultCallback& OnComplete)
+    {
+        OutJsonBody = ParseJsonBody(Request);
+        if (!OutJsonBody.IsValid())
+        {
+            SendErrorResponse(OnComplete, TEXT("Invalid JSON"));
+            return nullptr;
+        }
+        return FindGroup(Request, OutGroupId, OnComplete);
+    }
+
+    // 生きているメンバーにだけ処理を適用し、削除済みのアクターは配列から詰める
+    // 対象ワールドが指定されているときは、そのワールドのメンバーだけを対象にする
+    template <typename FunctionType>
+    int32 ForEachGroupMember(FActorGroup& Group, FunctionType&& Function)
+    {
+        int32 Affected = 0;
+        for (int32 Index = Group.Members.Num() - 1; Index >= 0; --Index)
+        {
+            if (IsStaleGroupMember(Group.Members[Index]))
+            {
+                Group.Members.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+                continue;
+            }
+
+            AActor* Actor = Group.Members[Index].Get();
+            if (CurrentWorld && Actor->GetWorld() != CurrentWorld)
+            {
+                continue;
+            }
+
+            Function(Actor);
+            ++Affected;
+        }
+        return Affected;
+    }
+
+    static bool IsStaleGroupMember(const TWeakObjectPtr<AActor>& Member)
+    {
+        const AActor* Actor = Member.Get();
+        return !Actor || Actor->IsActorBeingDestroyed();
+    }
+
+    // 削除済みのメンバーを詰め、いなくなったグループを登録から外す（インポート中のグループは残す）
+    bool RemoveGroupIfEmpty(int32 GroupId)
+    {
+        FActorGroup* Group = ActorGroups.Find(GroupId);
+        if (!Group)
+        {
+            return false;
+        }
+
+        Group->Members.RemoveAllSwap(&IsStaleGroupMember, EAllowShrinking::No);
+        if (Group->Members.Num() > 0 || Group->bImporting)
+        {
+            return false;
+        }
+
+        ActorGroups.Remove(GroupId);
+        return true;
+    }
+
+    // 削除済みのメンバーを詰め、空になったグループをまとめて外す
+    void PruneEmptyGroups()
+    {
+        for (TMap<int32, FActorGroup>::TIterator It = ActorGroups.CreateIterator(); It; ++It)
+        {
+            FActorGroup& Group = It.Value();
+            Group.Members.RemoveAllSwap(&IsStaleGroupMember, EAllowShrinking::No);
+            if (Group.Members.Num() == 0 && !Group.bImporting)
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+
+    // グループ操作の応答。操作で空になったグループはここで外す
+    void SendGroupResponse(const FHttpResultCallback& OnComplete, int32 GroupId, int32 Affected)
+    {
+        RemoveGroupIfEmpty(GroupId);
+
+        FJsonResponseWriter Writer;
+        Writer.BeginObject();
+        Writer.StringField("status", TEXT("success"));
+        Writer.IntField("groupId", GroupId);
+        Writer.IntField("affected", Affected);
+        Writer.EndObject();
+        SendJsonResponse(OnComplete, Writer);
+    }
+
+    // インポートを開始する。"path"があればそのファイルを読み、無ければ/imports/:id/chunksへのアップロードを待つ
+    bool HandleCreateImport(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    {
+        TSharedPtr<FJsonObject> JsonBody = ParseJsonBody(Request);
+        if (!JsonBody.IsValid())
+        {
+            SendErrorResponse(OnComplete, TEXT("Invalid JSON"));
+            return true;
+        }
+
+        UWorld* World = GetGameWorld();
+        if (!World)
+        {
+            SendErrorResponse(OnComplete, TEXT("No active world"));
+            return true;
+        }
+
+        FString Path;
+        JsonBody->TryGetStringField(TEXT("path"), Path);
+
+        // 形式の指定が無ければ拡張子で判断する
+        FString FormatName;
+        if (!JsonBody->TryGetStringField(TEXT("format"), FormatName))
+        {
+            FormatName = Path.EndsWith(TEXT(".bin")) ? TEXT("binary") : TEXT("ndjson");
+        }
+
+        EActorImportFormat Format;
+        if (FormatName == TEXT("ndjson"))
+        {
+            Format = EActorImportFormat::Ndjson;
+        }
+        else if (FormatName == TEXT("binary"))
+        {
+            Format = EActorImportFormat::Binary;
+        }
+        else
+        {
+            SendErrorResponse(OnComplete, FString::Printf(TEXT("Unknown import format: %s"), *FormatName));
+            return true;
+        }
+
+        TUniquePtr<IFileHandle> File;
+        if (!Path.IsEmpty())
+        {
+            File.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*Path));
+            if (!File)
+            {
+                SendErrorResponse(OnComplete, FString::Printf(TEXT("File not found: %s"), *Path), 404);
+                return true;
+            }
+        }
+
+        const int32 ImportId = NextImportId++;
+        FImportJob& Job = ImportJobs.Add(ImportId);
+        Job.Format = Format;
+        Job.Decoder = FActorImportDecoder(Format);
+        Job.World = World;
+        Job.StartTime = FPlatformTime::Seconds();
+        if (File)
+        {
+            Job.TotalBytes = File->Size();
+            Job.File = MoveTemp(File);
+        }
+
+        FString ProfileName;
+        if (JsonBody->TryGetStringField(TEXT("profile"), ProfileName))
+        {
+            Job.DefaultProfile = FindSpawnProfile(ProfileName);
+        }
+
+        // 作成したアクターは/actors/batchと同様にグループとして登録する
+        Job.GroupId = NextGroupId++;
+        FActorGroup& Group = ActorGroups.Add(Job.GroupId);
+        JsonBody->TryGetStringField(TEXT("group"), Group.Name);
+        Group.bImporting = true;
+
+        UE_LOG(LogTemp, Warning, TEXT("Started import %d (%s)"), ImportId, Path.IsEmpty() ? TEXT("upload") : *Path);
+
+        SendImportProgress(OnComplete, ImportId, Job);
+        return true;
+    }
+
+    // アップロードのチャンクを受け取る。?final=trueで入力の終わり
+    bool HandleImportChunk(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    {
+        int32 ImportId = 0;
+        FImportJob* Job = FindImport(Request, ImportId, OnComplete);
+        if (!Job)
+        {
+            return true;
+        }
+
+        // 終了したジョブ（ヘッダー不正やワールドの破棄で失敗した場合を含む）には積まない。積んでも作成されずに残り続ける
+        if (Job->bCompleted)
+        {
+            SendErrorResponse(OnComplete, Job->Error.IsEmpty() ? FString(TEXT("Import has already finished")) : Job->Error);
+            return true;
+        }
+
+        if (Job->File || Job->bInputFinished)
+        {
+            SendErrorResponse(OnComplete, TEXT("Import does not accept chunks"));
+            return true;
+        }
+
+        // 作成が追いつくまで受け取らない（クライアントはRetry-Afterの後に同じチャンクを送り直す）
+        if (Job->NumPending() >= CVarImportMaxPendingRecords.GetValueOnGameThread())
+        {
+            SendTooManyRequestsResponse(OnComplete);
+            return true;
+        }
+
+        if (Job->PendingHead > 0)
+        {
+            Job->Pending.RemoveAt(0, Job->PendingHead, EAllowShrinking::No);
+            Job->PendingHead = 0;
+        }
+
+        Job->Decoder.Feed(Request.Body.GetData(), Request.Body.Num(), Job->Pending);
+        Job->BytesRead += Request.Body.Num();
+
+        const FString* FinalParam = Request.QueryParams.Find(TEXT("final"));
+        if (FinalParam && (*FinalParam == TEXT("true") || *FinalParam == TEXT("1")))
+        {
+            Job->Decoder.Finish(Job->Pending);
+            Job->bInputFinished = true;
+        }
+
+        SendImportProgress(OnComplete, ImportId, *Job);
+        return true;
+    }
+
+    bool HandleGetImport(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    {
+        int32 ImportId = 0;
+        if (FImportJob* Job = FindImport(Request, ImportId, OnComplete))
+        {
+            SendImportProgress(OnComplete, ImportId, *Job);
+        }
+        return true;
+    }
+
+    // 実行中なら中止し、ジョブを破棄する（作成済みのアクターはグループに残る）
+    bool HandleCancelImport(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    {
+        int32 ImportId = 0;
+        FImportJob* Job = FindImport(Request, ImportId, OnComplete);
+        if (!Job)
+        {
+            return true;
+        }
+
+        if (!Job->bCompleted)
+        {
+            Job->bCancelled = true;
+            FinishImport(ImportId, *Job, FString());
+        }
+        SendImportProgress(OnComplete, ImportId, *Job);
+        ImportJobs.Remove(ImportId);
+        return true;
+    }
+
+    FImportJob* FindImport(const FHttpServerRequest& Request, int32& OutImportId, const FHttpResultCallback& OnComplete)
+    {
+        if (!TryGetRouteParam(Request, TEXT("id"), OutImportId))
+        {
+            SendErrorResponse(OnComplete, TEXT("Invalid import id"));
+            return nullptr;
+        }
+
+        FImportJob* Job = ImportJobs.Find(OutImportId);
+        if (!Job)
+        {
+            SendErrorResponse(OnComplete, TEXT("Import not found"), 404);
+        }
+        return Job;
+    }
+
+    // 実行中のインポートを、フレーム予算の範囲でデコード済みのレコードから順に作成する
+    bool TickImports(float DeltaTime)
+    {
+        if (ImportJobs.Num() == 0)
+        {
+            return true;
+        }
+
+        const double StartTime = FPlatformTime::Seconds();
+        const double Budget = CVarImportBudgetMs.GetValueOnGameThread() / 1000.0;
+
+        for (TPair<int32, FImportJob>& Entry : ImportJobs)
+        {
+            FImportJob& Job = Entry.Value;
+            if (Job.bCompleted)
+            {
+                continue;
+            }
+
+            UWorld* World = Job.World.Get();
+            if (!World)
+            {
+                FinishImport(Entry.Key, Job, TEXT("World was destroyed"));
+                continue;
+            }
+
+            FActorGroup* Group = ActorGroups.Find(Job.GroupId);
+
+            // エディターの更新は毎フレームではなくインポートの完了時に1回だけ行う
+            FBulkEditScope BulkEdit(World, false);
+
+            while (FPlatformTime::Seconds() - StartTime < Budget)
+            {
+                if (Job.NumPending() == 0 && !RefillImport(Job, StartTime + Budget))
+                {
+                    break;
+                }
+
+                AActor* NewActor = SpawnActorFromDesc(Job.Pending[Job.PendingHead++], World, Job.DefaultProfile);
+                if (NewActor)
+                {
+                    ++Job.Spawned;
+                    if (Group)
+                    {
+                        Group->Members.Add(NewActor);
+                    }
+                }
+                else
+                {
+                    ++Job.Failed;
+                }
+            }
+
+            if (Job.Decoder.IsInvalid())
+            {
+                FinishImport(Entry.Key, Job, TEXT("Invalid binary header"));
+            }
+            else if (Job.bInputFinished && Job.NumPending() == 0)
+            {
+                FinishImport(Entry.Key, Job, FString());
+            }
+
+            if (FPlatformTime::Seconds() - StartTime >= Budget)
+            {
+                break;
+            }
+        }
+
+        return true;
+    }
+
+    // 未作成のレコードを補充する。ファイルは次の数ブロックだけを、Deadlineまでの間に読む。補充できなければfalse
+    bool RefillImport(FImportJob& Job, double Deadline)
+    {
+        Job.Pending.Reset();
+        Job.PendingHead = 0;
+
+        // アップロードは次のチャンクを待つ
+        if (!Job.File)
+        {
+            return false;
+        }
+
+        ImportReadBuffer.SetNumUninitialized(ImportReadBlockSize, EAllowShrinking::No);
+        while (Job.Pending.Num() < ImportRefillRecords && !Job.bInputFinished && !Job.Decoder.IsInvalid() &&
+            FPlatformTime::Seconds() < Deadline)
+        {
+            const int32 ReadSize = static_cast<int32>(FMath::Min<int64>(Job.TotalBytes - Job.BytesRead, ImportReadBlockSize));
+            if (ReadSize <= 0 || !Job.File->Read(ImportReadBuffer.GetData(), ReadSize))
+            {
+                Job.Decoder.Finish(Job.Pending);
+                Job.bInputFinished = true;
+                Job.File.Reset();
+                break;
+            }
+
+            Job.BytesRead += ReadSize;
+            Job.Decoder.Feed(ImportReadBuffer.GetData(), ReadSize, Job.Pending);
+        }
+
+        return Job.Pending.Num() > 0;
+    }
+
+    // 完了・中止・失敗したジョブのバッファを解放する（進捗は問い合わせ用に残す）
+    void FinishImport(int32 ImportId, FImportJob& Job, const FString& Error)
+    {
+        if (FActorGroup* Group = ActorGroups.Find(Job.GroupId))
+        {
+            Group->bImporting = false;
+        }
+        RemoveGroupIfEmpty(Job.GroupId);
+
+        Job.bCompleted = true;
+        Job.Error = Error;
+        Job.EndTime = FPlatformTime::Seconds();
+        Job.File.Reset();
+        Job.Pending.Empty();
+        Job.PendingHead = 0;
+
+        // デコードできなかった行・レコードも失敗数に含めてからデコーダーを解放する
+        Job.Failed += Job.Decoder.GetErrorCount();
+        Job.Decoder = FActorImportDecoder(Job.Format);
+
+        UWorld* World = Job.World.Get();
+        if (World && World->WorldType == EWorldType::Editor)
+        {
+            FBulkEditScope::RefreshEditor();
+        }
+
+        UE_LOG(LogTemp, Warning, TEXT("Import %d finished: %d spawned, %d failed, %.2fs%s%s"),
+            ImportId, Job.Spawned, Job.Failed, Job.EndTime - Job.StartTime,
+            Error.IsEmpty() ? TEXT("") : TEXT(" - "), *Error);
+    }
+
+    void SendImportProgress(const FHttpResultCallback& OnComplete, int32 ImportId, const FImportJob& Job)
+    {
+        const TCHAR* State = TEXT("running");
+        if (Job.bCancelled)
+        {
+            State = TEXT("cancelled");
+        }
+        else if (Job.bCompleted)
+        {
+            State = Job.Error.IsEmpty() ? TEXT("completed") : TEXT("failed");
+        }
+
+        FJsonResponseWriter Writer;
+        Writer.BeginObject();
+        Writer.StringField("status", TEXT("success"));
+        Writer.IntField("importId", ImportId);
+        Writer.IntField("groupId", Job.GroupId);
+        Writer.StringField("state", State);
+        if (!Job.Error.IsEmpty())
+        {
+            Writer.StringField("error", Job.Error);
+        }
+        Writer.StringField("format", Job.Format == EActorImportFormat::Binary ? TEXT("binary") : TEXT("ndjson"));
+        Writer.IntField("bytesRead", Job.BytesRead);
+        Writer.IntField("totalBytes", Job.TotalBytes);
+        Writer.IntField("spawned", Job.Spawned);
+        Writer.IntField("failed", Job.Failed + Job.Decoder.GetErrorCount());
+        Writer.IntField("pending", Job.NumPending());
+        Writer.NumberField("elapsedSeconds", (Job.bCompleted ? Job.EndTime : FPlatformTime::Seconds()) - Job.StartTime);
+        Writer.EndObject();
+
+        SendJsonResponse(OnComplete, Writer);
+    }
+
+    bool HandleGetWorlds(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    {
+        // "default"はワールド指定の無いリクエストが使うワールド
+        UWorld* DefaultWorld = nullptr;
+        {
+            TGuardValue<UWorld*> WorldGuard(CurrentWorld, nullptr);
+            DefaultWorld = GetGameWorld();
+        }
+
+        FJsonResponseWriter Writer(64 + TargetWorlds.Num() * 96);
+        Writer.BeginObject();
+        Writer.Key("worlds");
+        Writer.BeginArray();
+        for (const FTargetWorld& Target : TargetWorlds)
+        {
+            UWorld* World = Target.World.Get();
+            if (!World)
+            {
+                continue;
+            }
+
+            Writer.BeginObject();
+            Writer.StringField("name", Target.Name);
+            Writer.StringField("context", Target.ContextHandle.ToString());
+            Writer.StringField("map", World->GetMapName());
+            Writer.BoolField("default", World == DefaultWorld);
+            Writer.EndObject();
+        }
+        Writer.EndArray();
+        Writer.EndObject();
+
+        SendJsonResponse(OnComplete, Writer);
+        return true;
+    }
+
+    bool HandleBatch(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    {
+        TSharedPtr<FJsonObject> JsonBody = ParseJsonBody(Request);
+        if (!JsonBody.IsValid())
+        {
+            SendErrorResponse(OnComplete, TEXT("Invalid JSON"));
+            return true;
+        }
+
+        const TArray<TSharedPtr<FJsonValue>>* Operations = nullptr;
+        if (!JsonBody->TryGetArrayField(TEXT("operations"), Operations))
+        {
+            SendErrorResponse(OnComplete, TEXT("Missing operations"));
+            return true;
+        }
+
+        bool bStopOnError = false;
+        JsonBody->TryGetBoolField(TEXT("stopOnError"), bStopOnError);
+
+        // 全操作をこのゲームスレッドの1回の処理で順番に実行する
+        FBulkEditScope BulkEdit(GetGameWorld());
+        TArray<TSharedRef<FBatchOperationResult>> Results;
+        Results.Reserve(Operations->Num());
+        int32 FailedCount = 0;
+        bool bStopped = false;
+
+        for (const TSharedPtr<FJsonValue>& OperationValue : *Operations)
+        {
+            TSharedRef<FBatchOperationResult> Result = Results.Add_GetRef(MakeShared<FBatchOperationResult>());
+            RunBatchOperation(OperationValue->AsObject(), Results, Result);
+
+            if (Result->StatusCode >= 400)
             {
-                FailCount++;
+                ++FailedCount;
+                if (bStopOnError)
+                {
+                    bStopped = Results.Num() < Operations->Num();
+                    break;
+                }
             }
         }
 
-        UE_LOG(LogTemp, Warning, TEXT("Batch created %d actors (failed: %d)"), SuccessCount, FailCount);
+        UE_LOG(LogTemp, Warning, TEXT("Batch executed %d operations (failed: %d)"), Results.Num(), FailedCount);
 
-        TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
-        ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
-        ResponseJson->SetNumberField(TEXT("created"), SuccessCount);
-        ResponseJson->SetNumberField(TEXT("failed"), FailCount);
-        
-        TArray<TSharedPtr<FJsonValue>> IdsArray;
-        for (const FString& Id : CreatedActorIds)
+        int32 ResultsSize = 0;
+        for (const TSharedRef<FBatchOperationResult>& Result : Results)
         {
-            IdsArray.Add(MakeShareable(new FJsonValueString(Id)));
+            ResultsSize += Result->Body.Num() + 32;
         }
-        ResponseJson->SetArrayField(TEXT("actorIds"), IdsArray);
-        
-        SendJsonResponse(OnComplete, ResponseJson);
+
+        FJsonResponseWriter Writer(128 + ResultsSize);
+        Writer.BeginObject();
+        Writer.StringField("status", FailedCount == 0 ? TEXT("success") : TEXT("partial"));
+        Writer.IntField("executed", Results.Num());
+        Writer.IntField("failed", FailedCount);
+        Writer.BoolField("stopped", bStopped);
+        Writer.Key("results");
+        Writer.BeginArray();
+        for (const TSharedRef<FBatchOperationResult>& Result : Results)
+        {
+            Writer.BeginObject();
+            Writer.IntField("status", Result->StatusCode);
+            Writer.Key("body");
+            if (Result->Body.Num() > 0)
+            {
+                // 各操作のレスポンス本体は再解析せずにそのまま埋め込む
+                Writer.RawValue(Result->Body);
+            }
+            else
+            {
+                Writer.Null();
+            }
+            Writer.EndObject();
+        }
+        Writer.EndArray();
+        Writer.EndObject();
+
+        SendJsonResponse(OnComplete, Writer);
         return true;
     }
 
-    bool HandleDeleteAllActors(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    // 1操作を該当ルートのハンドラーで直接実行する（受付制御はバッチ全体で1回）
+    void RunBatchOperation(const TSharedPtr<FJsonObject>& Operation, const TArray<TSharedRef<FBatchOperationResult>>& Results, const TSharedRef<FBatchOperationResult>& Result)
     {
-        UWorld* World = GetGameWorld();
-        if (!World)
+        FString Method;
+        FString Path;
+        if (!Operation.IsValid() || !Operation->TryGetStringField(TEXT("method"), Method) || !Operation->TryGetStringField(TEXT("path"), Path))
         {
-            SendErrorResponse(OnComplete, TEXT("No active world"));
+            SetBatchOperationError(*Result, TEXT("Operation requires method and path"), 400);
+            return;
+        }
+
+        FString ResolvedPath;
+        FString ReferenceError;
+        if (!ResolveBatchReferences(Path, Results, ResolvedPath, ReferenceError))
+        {
+            SetBatchOperationError(*Result, ReferenceError, 400);
+            return;
+        }
+
+        FHttpServerRequest SubRequest;
+        FString RoutePath;
+        SplitPathAndQuery(ResolvedPath, RoutePath, SubRequest.QueryParams);
+        SubRequest.Verb = ParseVerb(Method);
+        SubRequest.RelativePath = FHttpPath(RoutePath);
+
+        // 対象ワールドはバッチ全体で1つ（X-World・?worldはバッチのリクエストに付ける）
+        if (SubRequest.QueryParams.Contains(TEXT("world")))
+        {
+            SetBatchOperationError(*Result, TEXT("Specify the target world on the batch request"), 400);
+            return;
+        }
+
+        const FRouteEntry* Route = MatchRoute(SubRequest.Verb, RoutePath, SubRequest.PathParams);
+        if (!Route)
+        {
+            SetBatchOperationError(*Result, TEXT("Route not found"), 404);
+            return;
+        }
+
+        if (Route->Handler == &UE5HTTPServer::HandleBatch)
+        {
+            SetBatchOperationError(*Result, TEXT("Nested batches are not supported"), 400);
+            return;
+        }
+
+        // 本体は解析済みのJSONをそのまま渡す（文字列化して再解析しない）
+        const TSharedPtr<FJsonObject>* BodyObj = nullptr;
+        {
+            // 本体の無い操作はnullのまま渡し、ハンドラーの"Invalid JSON"の判定に任せる
+            TGuardValue<TSharedPtr<FJsonObject>> BodyGuard(PreparsedBody, Operation->TryGetObjectField(TEXT("body"), BodyObj) ? *BodyObj : nullptr);
+            TGuardValue<bool> InlineGuard(bRespondInline, true);
+
+            (this->*Route->Handler)(SubRequest, [Result](TUniquePtr<FHttpServerResponse>&& Response)
+            {
+                Result->bCompleted = true;
+                Result->StatusCode = static_cast<int32>(Response->Code);
+                Result->Body = MoveTemp(Response->Body);
+            });
+        }
+
+        // 非同期でしか完了しない操作はバッチでは扱えない
+        if (!Result->bCompleted)
+        {
+            SetBatchOperationError(*Result, TEXT("Operation does not complete synchronously"), 400);
+        }
+    }
+
+    void SetBatchOperationError(FBatchOperationResult& Result, const FString& ErrorMessage, int32 StatusCode)
+    {
+        Result.bCompleted = true;
+        Result.StatusCode = StatusCode;
+        Result.Body = MoveTemp(CreateErrorResponse(ErrorMessage, StatusCode)->Body);
+    }
+
+    // パス中の"${N.field}"や"${N.field[i]}"を、同じバッチのN番目の結果の値で置き換える
+    static bool ResolveBatchReferences(const FString& Path, const TArray<TSharedRef<FBatchOperationResult>>& Results, FString& OutPath, FString& OutError)
+    {
+        int32 Start = Path.Find(TEXT("${"), ESearchCase::CaseSensitive);
+        if (Start == INDEX_NONE)
+        {
+            OutPath = Path;
             return true;
         }
 
-        int32 DeletedCount = 0;
-        TArray<AActor*> ActorsToDelete;
+        OutPath.Reset(Path.Len());
+        int32 Cursor = 0;
+        while (Start != INDEX_NONE)
+        {
+            const int32 End = Path.Find(TEXT("}"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Start);
+            if (End == INDEX_NONE)
+            {
+                OutError = TEXT("Unterminated reference");
+                return false;
+            }
 
-        // まず削除対象のアクターを収集
-        for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
+            OutPath.AppendChars(*Path + Cursor, Start - Cursor);
+
+            FString Value;
+            if (!LookupBatchReference(Path.Mid(Start + 2, End - Start - 2), Results, Value, OutError))
+            {
+                return false;
+            }
+            OutPath += Value;
+
+            Cursor = End + 1;
+            Start = Path.Find(TEXT("${"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Cursor);
+        }
+
+        OutPath.AppendChars(*Path + Cursor, Path.Len() - Cursor);
+        return true;
+    }
+
+    static bool LookupBatchReference(const FString& Reference, const TArray<TSharedRef<FBatchOperationResult>>& Results, FString& OutValue, FString& OutError)
+    {
+        OutError = FString::Printf(TEXT("Invalid reference: %s"), *Reference);
+
+        FString IndexText;
+        FString FieldPath;
+        int32 ResultIndex = INDEX_NONE;
+        if (!Reference.Split(TEXT("."), &IndexText, &FieldPath) || !LexTryParseString(ResultIndex, *IndexText))
         {
-            AActor* Actor = *ActorItr;
-            
-            // システムアクターは削除しない
-            if (Actor->IsA<AWorldSettings>() || 
-                Actor->GetActorLabel().IsEmpty() ||
-                Actor->GetActorLabel().Contains(TEXT("DefaultPhysicsVolume")) ||
-                Actor->GetActorLabel().Contains(TEXT("WorldPartition")) ||
-                Actor->GetActorLabel().Contains(TEXT("GameplayDebugger")) ||
-                Actor->GetActorLabel().Contains(TEXT("WorldDataLayers")) ||
-                Actor->GetActorLabel().Contains(TEXT("Brush")))
+            return false;
+        }
+
+        // 参照できるのは現在の操作より前の結果のみ（末尾は実行中の操作）
+        if (ResultIndex < 0 || ResultIndex >= Results.Num() - 1)
+        {
+            return false;
+        }
+
+        FBatchOperationResult& Result = *Results[ResultIndex];
+        if (!Result.ParsedBody.IsValid() && Result.Body.Num() > 0)
+        {
+            FUTF8ToTCHAR BodyConverter(reinterpret_cast<const ANSICHAR*>(Result.Body.GetData()), Result.Body.Num());
+            TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(FString(BodyConverter.Length(), BodyConverter.Get()));
+            FJsonSerializer::Deserialize(Reader, Result.ParsedBody);
+        }
+
+        if (!Result.ParsedBody.IsValid())
+        {
+            return false;
+        }
+
+        // "field[i]"は配列の要素を参照する
+        int32 BracketIndex = INDEX_NONE;
+        if (FieldPath.FindChar(TEXT('['), BracketIndex) && FieldPath.EndsWith(TEXT("]")))
+        {
+            int32 ArrayIndex = INDEX_NONE;
+            const TArray<TSharedPtr<FJsonValue>>* ArrayValue = nullptr;
+            if (!LexTryParseString(ArrayIndex, *FieldPath.Mid(BracketIndex + 1, FieldPath.Len() - BracketIndex - 2)) ||
+                !Result.ParsedBody->TryGetArrayField(FieldPath.Left(BracketIndex), ArrayValue) ||
+                !ArrayValue->IsValidIndex(ArrayIndex))
             {
-                continue;
+                return false;
+            }
+            return (*ArrayValue)[ArrayIndex]->TryGetString(OutValue);
+        }
+
+        return Result.ParsedBody->TryGetStringField(FieldPath, OutValue);
+    }
+
+    // "."区切りのパスをプロパティの列に解決する。失敗時はChainを空のまま返す
+    static void ResolvePropertyPath(UStruct* RootStruct, const FString& Path, FResolvedPropertyPath& OutPath)
+    {
+        TArray<FString> Segments;
+        Path.ParseIntoArray(Segments, TEXT("."), true);
+
+        UStruct* CurrentStruct = RootStruct;
+        for (int32 Index = 0; Index < Segments.Num(); ++Index)
+        {
+            FProperty* Property = CurrentStruct ? FindFProperty<FProperty>(CurrentStruct, *Segments[Index]) : nullptr;
+            if (!Property)
+            {
+                OutPath.Chain.Reset();
+                return;
+            }
+
+            OutPath.Chain.Add(Property);
+
+            if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+            {
+                CurrentStruct = StructProperty->Struct;
+            }
+            else if (FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Property))
+            {
+                CurrentStruct = ObjectProperty->PropertyClass;
+            }
+            else
+            {
+                CurrentStruct = nullptr;
             }
-            
-            ActorsToDelete.Add(Actor);
         }
+    }
+
+    static bool SetPropertyValue(AActor* Actor, const FResolvedPropertyPath& Resolved, const TSharedPtr<FJsonValue>& Value)
+    {
+        UObject* Owner = Actor;
+        void* Container = Actor;
+        // 変更通知に使う、所有オブジェクト直下のプロパティ
+        FProperty* ChangedProperty = nullptr;
 
-        // アクターを削除
-        for (AActor* Actor : ActorsToDelete)
+        for (int32 Index = 0; Index < Resolved.Chain.Num() - 1; ++Index)
         {
-            Actor->Destroy();
-            DeletedCount++;
+            FProperty* Property = Resolved.Chain[Index];
+            void* ValuePtr = Property->ContainerPtrToValuePtr<void>(Container);
+
+            if (FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Property))
+            {
+                UObject* Object = ObjectProperty->GetObjectPropertyValue(ValuePtr);
+                if (!Object)
+                {
+                    return false;
+                }
+                Owner = Object;
+                Container = Object;
+                ChangedProperty = nullptr;
+            }
+            else
+            {
+                if (!ChangedProperty)
+                {
+                    ChangedProperty = Property;
+                }
+                Container = ValuePtr;
+            }
         }
 
-        UE_LOG(LogTemp, Warning, TEXT("Deleted %d actors"), DeletedCount);
+        FProperty* LeafProperty = Resolved.Chain.Last();
+        if (!ChangedProperty)
+        {
+            ChangedProperty = LeafProperty;
+        }
+
+        // 先に現在の値の複製へ変換し、成功したときだけ変更通知で挟んで書き込む
+        // （PreEditChangeだけが呼ばれるとコンポーネントが登録解除されたまま残る）
+        void* LeafValue = LeafProperty->ContainerPtrToValuePtr<void>(Container);
+        void* TempValue = FMemory::Malloc(LeafProperty->GetSize(), LeafProperty->GetMinAlignment());
+        LeafProperty->InitializeValue(TempValue);
+        LeafProperty->CopyCompleteValue(TempValue, LeafValue);
+
+        const bool bConverted = FJsonObjectConverter::JsonValueToUProperty(Value, LeafProperty, TempValue, 0, 0);
+        if (bConverted)
+        {
+#if WITH_EDITOR
+            Owner->PreEditChange(ChangedProperty);
+#endif
+            LeafProperty->CopyCompleteValue(LeafValue, TempValue);
+        }
+
+        LeafProperty->DestroyValue(TempValue);
+        FMemory::Free(TempValue);
+
+        if (!bConverted)
+        {
+            return false;
+        }
+
+#if WITH_EDITOR
+        FPropertyChangedEvent ChangedEvent(ChangedProperty);
+        Owner->PostEditChangeProperty(ChangedEvent);
+#else
+        if (USceneComponent* SceneComponent = Cast<USceneComponent>(Owner))
+        {
+            SceneComponent->UpdateComponentToWorld();
+        }
+        if (UActorComponent* Component = Cast<UActorComponent>(Owner))
+        {
+            Component->MarkRenderStateDirty();
+        }
+#endif
 
-        TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
-        ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
-        ResponseJson->SetNumberField(TEXT("deletedCount"), DeletedCount);
-        
-        SendJsonResponse(OnComplete, ResponseJson);
         return true;
     }
 
-    bool HandleSetActorColor(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    bool HandleGetSceneInfo(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
     {
-        FString Path = Request.RelativePath.GetPath();
-        TArray<FString> PathParts;
-        Path.ParseIntoArray(PathParts, TEXT("/"), true);
-        
-        if (PathParts.Num() < 2)
+        UWorld* World = GetGameWorld();
+        if (!World)
         {
-            SendErrorResponse(OnComplete, TEXT("Invalid path"));
+            SendErrorResponse(OnComplete, TEXT("No active world"));
             return true;
         }
 
-        FString ActorName = PathParts[1];
-        
-        TSharedPtr<FJsonObject> JsonBody = ParseJsonBody(Request);
-        if (!JsonBody.IsValid())
+        // 小数の桁数（?precision=で指定可能。桁を落とすとレスポンスが大きく縮む）
+        int32 FloatPrecision = CVarFloatPrecision.GetValueOnGameThread();
+        if (const FString* PrecisionParam = Request.QueryParams.Find(TEXT("precision")))
         {
-            SendErrorResponse(OnComplete, TEXT("Invalid JSON"));
+            FloatPrecision = FMath::Clamp(FCString::Atoi(**PrecisionParam), 0, FJsonResponseWriter::MaxFloatPrecision);
+        }
+
+        // ゲームスレッドではアクターの状態をスナップショットに写すだけにする
+        TSharedRef<FSceneSnapshot> Snapshot = MakeShared<FSceneSnapshot>();
+        CaptureSceneSnapshot(World, *Snapshot);
+
+        UE_LOG(LogTemp, Warning, TEXT("Retrieved scene info with %d actors"), Snapshot->Num());
+
+        // 小さなシーンはタスクに渡すより、その場で書いた方が速い。/batchの中では大きくてもその場で書く
+        if (bRespondInline || Snapshot->Num() <= SceneChunkSize)
+        {
+            OnComplete(CreateJsonResponse(FormatSceneSnapshot(*Snapshot, FloatPrecision), 200));
             return true;
         }
 
-        TSharedPtr<FJsonObject> ColorObj = JsonBody->GetObjectField(TEXT("color"));
-        FLinearColor NewColor(
-            ColorObj->GetNumberField(TEXT("r")),
-            ColorObj->GetNumberField(TEXT("g")),
-            ColorObj->GetNumberField(TEXT("b")),
-            ColorObj->HasField(TEXT("a")) ? ColorObj->GetNumberField(TEXT("a")) : 1.0f
-        );
+        // JSONの整形はタスクグラフ上でチャンクごとに並列に行い、結合まで済ませてからゲームスレッドで返す
+        UE::Tasks::Launch(UE_SOURCE_LOCATION, [Snapshot, FloatPrecision, OnComplete]()
+        {
+            TUniquePtr<FHttpServerResponse> Response = CreateJsonResponse(FormatSceneSnapshot(*Snapshot, FloatPrecision), 200);
+
+            AsyncTask(ENamedThreads::GameThread, [OnComplete, Response = MoveTemp(Response)]() mutable
+            {
+                OnComplete(MoveTemp(Response));
+            });
+        });
+
+        return true;
+    }
+
+    // アクターの状態を配列の構造体に詰める。ここでは文字列化や整形をしない
+    static void CaptureSceneSnapshot(UWorld* World, FSceneSnapshot& Snapshot)
+    {
+        TMap<UClass*, int32> ClassIndexMap;
+        UClass* LastClass = nullptr;
+        int32 LastClassIndex = INDEX_NONE;
+
+        for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
+        {
+            AActor* Actor = *ActorItr;
+            
+            if (Actor->IsA<AWorldSettings>() || Actor->GetActorLabel().IsEmpty())
+                continue;
+
+            // 同じクラスが連続することが多いので直前のクラスを先に見る
+            UClass* ActorClass = Actor->GetClass();
+            if (ActorClass != LastClass)
+            {
+                int32* FoundIndex = ClassIndexMap.Find(ActorClass);
+                LastClassIndex = FoundIndex ? *FoundIndex : ClassIndexMap.Add(ActorClass, Snapshot.ClassNames.Add(ActorClass->GetName()));
+                LastClass = ActorClass;
+            }
+
+            Snapshot.Labels.Add(Actor->GetActorLabel());
+            Snapshot.ClassIndices.Add(LastClassIndex);
+
+            const FTransform& Transform = Actor->GetActorTransform();
+            const FVector Location = Transform.GetLocation();
+            const FRotator Rotation = Transform.Rotator();
+            const FVector Scale = Transform.GetScale3D();
+
+            double* Packed = Snapshot.Transforms.AddUninitialized(FSceneSnapshot::TransformStride).GetData();
+            Packed[0] = Location.X;
+            Packed[1] = Location.Y;
+            Packed[2] = Location.Z;
+            Packed[3] = Rotation.Pitch;
+            Packed[4] = Rotation.Yaw;
+            Packed[5] = Rotation.Roll;
+            Packed[6] = Scale.X;
+            Packed[7] = Scale.Y;
+            Packed[8] = Scale.Z;
+        }
+    }
+
+    // スナップショットをJSONに整形する。チャンク単位で並列に書き、最後に連結する
+    static TArray<uint8> FormatSceneSnapshot(const FSceneSnapshot& Snapshot, int32 FloatPrecision)
+    {
+        const int32 ActorCount = Snapshot.Num();
+        const int32 ChunkCount = FMath::DivideAndRoundUp(ActorCount, SceneChunkSize);
+
+        TArray<TArray<uint8>> Chunks;
+        Chunks.SetNum(ChunkCount);
+
+        ParallelFor(ChunkCount, [&Snapshot, &Chunks, FloatPrecision, ActorCount](int32 ChunkIndex)
+        {
+            const int32 Begin = ChunkIndex * SceneChunkSize;
+            const int32 End = FMath::Min(Begin + SceneChunkSize, ActorCount);
+
+            FJsonResponseWriter ChunkWriter((End - Begin) * SceneBytesPerActor, FloatPrecision);
+            ChunkWriter.BeginArray();
+            for (int32 Index = Begin; Index < End; ++Index)
+            {
+                WriteSceneActor(ChunkWriter, Snapshot, Index);
+            }
+            ChunkWriter.EndArray();
+            Chunks[ChunkIndex] = ChunkWriter.Finish();
+        }, ChunkCount <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+        int32 TotalSize = 64;
+        for (const TArray<uint8>& Chunk : Chunks)
+        {
+            TotalSize += Chunk.Num() + 1;
+        }
+
+        FJsonResponseWriter Writer(TotalSize, FloatPrecision);
+        Writer.BeginObject();
+        Writer.Key("actors");
+        Writer.BeginArray();
+        for (const TArray<uint8>& Chunk : Chunks)
+        {
+            // チャンクの配列の括弧を外し、要素だけを連結する
+            Writer.RawValue(MakeArrayView(Chunk.GetData() + 1, Chunk.Num() - 2));
+        }
+        Writer.EndArray();
+        Writer.IntField("actorCount", ActorCount);
+        Writer.EndObject();
+        return Writer.Finish();
+    }
+
+    static void WriteSceneActor(FJsonResponseWriter& Writer, const FSceneSnapshot& Snapshot, int32 Index)
+    {
+        const double* Packed = Snapshot.Transforms.GetData() + Index * FSceneSnapshot::TransformStride;
+
+        Writer.BeginObject();
+        Writer.StringField("name", Snapshot.Labels[Index]);
+        Writer.StringField("class", Snapshot.ClassNames[Snapshot.ClassIndices[Index]]);
+
+        Writer.Key("location");
+        Writer.BeginObject();
+        Writer.NumberField("x", Packed[0]);
+        Writer.NumberField("y", Packed[1]);
+        Writer.NumberField("z", Packed[2]);
+        Writer.EndObject();
+
+        Writer.Key("rotation");
+        Writer.BeginObject();
+        Writer.NumberField("pitch", Packed[3]);
+        Writer.NumberField("yaw", Packed[4]);
+        Writer.NumberField("roll", Packed[5]);
+        Writer.EndObject();
+
+        Writer.Key("scale");
+        Writer.BeginObject();
+        Writer.NumberField("x", Packed[6]);
+        Writer.NumberField("y", Packed[7]);
+        Writer.NumberField("z", Packed[8]);
+        Writer.EndObject();
+
+        Writer.EndObject();
+    }
 
-        AActor* FoundActor = FindActorByName(ActorName);
-        
-        if (FoundActor)
+    // 色変更に対応しているアクターか
+    bool SupportsColor(AActor* Actor) const
+    {
+        return Actor && (Actor->IsA<AStaticMeshActor>() || Actor->IsA<APointLight>());
+    }
+
+    bool SetActorColor(AActor* Actor, const FLinearColor& NewColor)
+    {
+        // StaticMeshActorの場合
+        if (AStaticMeshActor* MeshActor = Cast<AStaticMeshActor>(Actor))
         {
-            bool bColorSet = false;
-            
-            // StaticMeshActorの場合
-            if (AStaticMeshActor* MeshActor = Cast<AStaticMeshActor>(FoundActor))
+            UStaticMeshComponent* MeshComponent = MeshActor->GetStaticMeshComponent();
+            if (MeshComponent)
             {
-                UStaticMeshComponent* MeshComponent = MeshActor->GetStaticMeshComponent();
-                if (MeshComponent)
+                // 既存のマテリアルを取得
+                UMaterialInterface* CurrentMaterial = MeshComponent->GetMaterial(0);
+                UMaterialInstanceDynamic* DynMaterial = Cast<UMaterialInstanceDynamic>(CurrentMaterial);
+
+                // 動的マテリアルインスタンスが無い場合は作成
+                if (!DynMaterial)
                 {
-                    // 既存のマテリアルを取得
-                    UMaterialInterface* CurrentMaterial = MeshComponent->GetMaterial(0);
-                    UMaterialInstanceDynamic* DynMaterial = Cast<UMaterialInstanceDynamic>(CurrentMaterial);
-                    
-                    // 動的マテリアルインスタンスが無い場合は作成
-                    if (!DynMaterial)
-                    {
-                        UMaterial* BaseMaterial = LoadObject<UMaterial>(nullptr, TEXT("/Engine/BasicShapes/BasicShapeMaterial.BasicShapeMaterial"));
-                        if (BaseMaterial)
-                        {
-                            DynMaterial = UMaterialInstanceDynamic::Create(BaseMaterial, MeshActor);
-                            MeshComponent->SetMaterial(0, DynMaterial);
-                        }
-                    }
-                    
-                    if (DynMaterial)
+                    UMaterial* BaseMaterial = LoadObject<UMaterial>(nullptr, TEXT("/Engine/BasicShapes/BasicShapeMaterial.BasicShapeMaterial"));
+                    if (BaseMaterial)
                     {
-                        DynMaterial->SetVectorParameterValue(TEXT("Color"), NewColor);
-                        bColorSet = true;
+                        DynMaterial = UMaterialInstanceDynamic::Create(BaseMaterial, MeshActor);
+                        MeshComponent->SetMaterial(0, DynMaterial);
                     }
                 }
-            }
-            // PointLightの場合
-            else if (APointLight* LightActor = Cast<APointLight>(FoundActor))
-            {
-                if (UPointLightComponent* LightComponent = LightActor->PointLightComponent)
+
+                if (DynMaterial)
                 {
-                    LightComponent->SetLightColor(NewColor);
-                    bColorSet = true;
+                    DynMaterial->SetVectorParameterValue(TEXT("Color"), NewColor);
+                    return true;
                 }
             }
-            
-            if (bColorSet)
-            {
-                UE_LOG(LogTemp, Warning, TEXT("Set color of actor: %s to (%f, %f, %f, %f)"), 
-                    *ActorName, NewColor.R, NewColor.G, NewColor.B, NewColor.A);
-                
-                TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
-                ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
-                SendJsonResponse(OnComplete, ResponseJson);
-            }
-            else
-            {
-                SendErrorResponse(OnComplete, TEXT("Actor does not support color changes"));
-            }
         }
-        else
+        // PointLightの場合
+        else if (APointLight* LightActor = Cast<APointLight>(Actor))
         {
-            SendErrorResponse(OnComplete, TEXT("Actor not found"), 404);
+            if (UPointLightComponent* LightComponent = LightActor->PointLightComponent)
+            {
+                LightComponent->SetLightColor(NewColor);
+                return true;
+            }
         }
 
-        return true;
+        return false;
     }
 
-    bool HandleSetActorScale(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    FLinearColor GetActorColor(AActor* Actor) const
     {
-        FString Path = Request.RelativePath.GetPath();
-        TArray<FString> PathParts;
-        Path.ParseIntoArray(PathParts, TEXT("/"), true);
-        
-        if (PathParts.Num() < 2)
+        FLinearColor Color = FLinearColor::White;
+        if (AStaticMeshActor* MeshActor = Cast<AStaticMeshActor>(Actor))
         {
-            SendErrorResponse(OnComplete, TEXT("Invalid path"));
-            return true;
+            UStaticMeshComponent* MeshComponent = MeshActor->GetStaticMeshComponent();
+            if (UMaterialInstanceDynamic* DynMaterial = MeshComponent ? Cast<UMaterialInstanceDynamic>(MeshComponent->GetMaterial(0)) : nullptr)
+            {
+                DynMaterial->GetVectorParameterValue(TEXT("Color"), Color);
+            }
         }
-
-        FString ActorName = PathParts[1];
-        
-        TSharedPtr<FJsonObject> JsonBody = ParseJsonBody(Request);
-        if (!JsonBody.IsValid())
+        else if (APointLight* LightActor = Cast<APointLight>(Actor))
         {
-            SendErrorResponse(OnComplete, TEXT("Invalid JSON"));
-            return true;
+            if (LightActor->PointLightComponent)
+            {
+                Color = LightActor->PointLightComponent->GetLightColor();
+            }
         }
+        return Color;
+    }
 
-        TSharedPtr<FJsonObject> ScaleObj = JsonBody->GetObjectField(TEXT("scale"));
-        FVector NewScale;
-        
+    // JSONの値読み取り
+    static FVector ReadLocation(const TSharedPtr<FJsonObject>& LocationObj)
+    {
+        return FVector(
+            LocationObj->GetNumberField(TEXT("x")),
+            LocationObj->GetNumberField(TEXT("y")),
+            LocationObj->GetNumberField(TEXT("z"))
+        );
+    }
+
+    static FRotator ReadRotation(const TSharedPtr<FJsonObject>& RotationObj)
+    {
+        return FRotator(
+            RotationObj->GetNumberField(TEXT("pitch")),
+            RotationObj->GetNumberField(TEXT("yaw")),
+            RotationObj->GetNumberField(TEXT("roll"))
+        );
+    }
+
+    static FVector ReadScale(const TSharedPtr<FJsonObject>& ScaleObj)
+    {
         if (ScaleObj->HasField(TEXT("uniform")))
         {
             float UniformScale = ScaleObj->GetNumberField(TEXT("uniform"));
-            NewScale = FVector(UniformScale, UniformScale, UniformScale);
-        }
-        else
-        {
-            NewScale = FVector(
-                ScaleObj->GetNumberField(TEXT("x")),
-                ScaleObj->GetNumberField(TEXT("y")),
-                ScaleObj->GetNumberField(TEXT("z"))
-            );
+            return FVector(UniformScale, UniformScale, UniformScale);
         }
 
-        AActor* FoundActor = FindActorByName(ActorName);
-        
-        if (FoundActor)
-        {
-            FoundActor->SetActorScale3D(NewScale);
-            
-            UE_LOG(LogTemp, Warning, TEXT("Set scale of actor: %s to (%f, %f, %f)"), 
-                *ActorName, NewScale.X, NewScale.Y, NewScale.Z);
-            
-            TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
-            ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
-            SendJsonResponse(OnComplete, ResponseJson);
-        }
-        else
-        {
-            SendErrorResponse(OnComplete, TEXT("Actor not found"), 404);
-        }
+        return FVector(
+            ScaleObj->GetNumberField(TEXT("x")),
+            ScaleObj->GetNumberField(TEXT("y")),
+            ScaleObj->GetNumberField(TEXT("z"))
+        );
+    }
 
-        return true;
+    static FLinearColor ReadColor(const TSharedPtr<FJsonObject>& ColorObj)
+    {
+        return FLinearColor(
+            ColorObj->GetNumberField(TEXT("r")),
+            ColorObj->GetNumberField(TEXT("g")),
+            ColorObj->GetNumberField(TEXT("b")),
+            ColorObj->HasField(TEXT("a")) ? ColorObj->GetNumberField(TEXT("a")) : 1.0f
+        );
     }
 
-    bool HandleDeleteActor(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    // 補間の値は全プロパティ共通でFVector4として扱う
+    // 回転はクォータニオンのXYZWで持ち、区間ごとに球面補間する（角度のまま補間すると170→-170で逆回りになる）
+    static FVector4 RotationToTweenValue(const FRotator& Rotation)
     {
-        FString Path = Request.RelativePath.GetPath();
-        TArray<FString> PathParts;
-        Path.ParseIntoArray(PathParts, TEXT("/"), true);
-        
-        if (PathParts.Num() < 2)
-        {
-            SendErrorResponse(OnComplete, TEXT("Invalid path"));
-            return true;
-        }
+        const FQuat Quat = Rotation.Quaternion();
+        return FVector4(Quat.X, Quat.Y, Quat.Z, Quat.W);
+    }
 
-        FString ActorName = PathParts[1];
-        AActor* FoundActor = FindActorByName(ActorName);
-        
-        if (FoundActor)
-        {
-            FoundActor->Destroy();
-            
-            UE_LOG(LogTemp, Warning, TEXT("Deleted actor: %s"), *ActorName);
-            
-            TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
-            ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
-            SendJsonResponse(OnComplete, ResponseJson);
-        }
-        else
+    static FQuat TweenValueToQuat(const FVector4& Value)
+    {
+        return FQuat(Value.X, Value.Y, Value.Z, Value.W);
+    }
+
+    static FVector4 ColorToTweenValue(const FLinearColor& Color)
+    {
+        return FVector4(Color.R, Color.G, Color.B, Color.A);
+    }
+
+    static FVector4 ReadTweenValue(ETweenProperty Property, const TSharedPtr<FJsonObject>& ValueObj)
+    {
+        switch (Property)
         {
-            SendErrorResponse(OnComplete, TEXT("Actor not found"), 404);
+        case ETweenProperty::Rotation: return RotationToTweenValue(ReadRotation(ValueObj));
+        case ETweenProperty::Scale:    return FVector4(ReadScale(ValueObj), 0.0);
+        case ETweenProperty::Color:    return ColorToTweenValue(ReadColor(ValueObj));
+        default:                       return FVector4(ReadLocation(ValueObj), 0.0);
         }
-
-        return true;
     }
 
-    bool HandleMoveActor(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    FVector4 GetTweenValue(AActor* Actor, ETweenProperty Property) const
     {
-        FString Path = Request.RelativePath.GetPath();
-        TArray<FString> PathParts;
-        Path.ParseIntoArray(PathParts, TEXT("/"), true);
-        
-        if (PathParts.Num() < 2)
+        switch (Property)
         {
-            SendErrorResponse(OnComplete, TEXT("Invalid path"));
-            return true;
+        case ETweenProperty::Rotation: return RotationToTweenValue(Actor->GetActorRotation());
+        case ETweenProperty::Scale:    return FVector4(Actor->GetActorScale3D(), 0.0);
+        case ETweenProperty::Color:    return ColorToTweenValue(GetActorColor(Actor));
+        default:                       return FVector4(Actor->GetActorLocation(), 0.0);
         }
+    }
 
-        FString ActorName = PathParts[1];
-        
-        TSharedPtr<FJsonObject> JsonBody = ParseJsonBody(Request);
-        if (!JsonBody.IsValid())
+    void ApplyTweenValue(AActor* Actor, ETweenProperty Property, const FVector4& Value)
+    {
+        switch (Property)
         {
-            SendErrorResponse(OnComplete, TEXT("Invalid JSON"));
-            return true;
+        case ETweenProperty::Location:
+            Actor->SetActorLocation(FVector(Value.X, Value.Y, Value.Z));
+            break;
+        case ETweenProperty::Rotation:
+            Actor->SetActorRotation(TweenValueToQuat(Value));
+            break;
+        case ETweenProperty::Scale:
+            Actor->SetActorScale3D(FVector(Value.X, Value.Y, Value.Z));
+            break;
+        case ETweenProperty::Color:
+            SetActorColor(Actor, FLinearColor(Value.X, Value.Y, Value.Z, Value.W));
+            break;
         }
+    }
 
-        TSharedPtr<FJsonObject> LocationObj = JsonBody->GetObjectField(TEXT("location"));
-        FVector NewLocation(
-            LocationObj->GetNumberField(TEXT("x")),
-            LocationObj->GetNumberField(TEXT("y")),
-            LocationObj->GetNumberField(TEXT("z"))
-        );
+    static ETweenEasing ParseEasing(const FString& EasingName)
+    {
+        if (EasingName == TEXT("easeIn"))    return ETweenEasing::EaseIn;
+        if (EasingName == TEXT("easeOut"))   return ETweenEasing::EaseOut;
+        if (EasingName == TEXT("easeInOut")) return ETweenEasing::EaseInOut;
+        return ETweenEasing::Linear;
+    }
 
-        AActor* FoundActor = FindActorByName(ActorName);
-        
-        if (FoundActor)
+    static double ApplyEasing(ETweenEasing Easing, double Alpha)
+    {
+        switch (Easing)
         {
-            FoundActor->SetActorLocation(NewLocation);
-            
-            UE_LOG(LogTemp, Warning, TEXT("Moved actor: %s to location (%f, %f, %f)"), 
-                *ActorName, NewLocation.X, NewLocation.Y, NewLocation.Z);
-            
-            TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
-            ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
-            SendJsonResponse(OnComplete, ResponseJson);
+        case ETweenEasing::EaseIn:    return Alpha * Alpha;
+        case ETweenEasing::EaseOut:   return 1.0 - (1.0 - Alpha) * (1.0 - Alpha);
+        case ETweenEasing::EaseInOut: return Alpha * Alpha * (3.0 - 2.0 * Alpha);
+        default:                      return Alpha;
         }
-        else
+    }
+
+    // 通過点を等間隔の区間として扱い、イージング後の進捗から現在値を求める
+    static FVector4 EvaluateTween(const FActorTween& Tween, double EasedAlpha)
+    {
+        const int32 SegmentCount = Tween.Keyframes.Num();
+        const double Position = EasedAlpha * SegmentCount;
+        const int32 Segment = FMath::Clamp(FMath::FloorToInt32(Position), 0, SegmentCount - 1);
+        const FVector4& SegmentStart = Segment == 0 ? Tween.From : Tween.Keyframes[Segment - 1];
+        const FVector4& SegmentEnd = Tween.Keyframes[Segment];
+        const double SegmentAlpha = Position - Segment;
+
+        // Slerpは短い方の回転経路を選ぶ
+        if (Tween.Property == ETweenProperty::Rotation)
         {
-            SendErrorResponse(OnComplete, TEXT("Actor not found"), 404);
+            const FQuat Quat = FQuat::Slerp(TweenValueToQuat(SegmentStart), TweenValueToQuat(SegmentEnd), SegmentAlpha);
+            return FVector4(Quat.X, Quat.Y, Quat.Z, Quat.W);
         }
-
-        return true;
+        return SegmentStart + (SegmentEnd - SegmentStart) * SegmentAlpha;
     }
 
-    bool HandleRotateActor(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    void CancelTween(AActor* Actor, ETweenProperty Property)
     {
-        FString Path = Request.RelativePath.GetPath();
-        TArray<FString> PathParts;
-        Path.ParseIntoArray(PathParts, TEXT("/"), true);
-        
-        if (PathParts.Num() < 2)
+        for (int32 Index = ActiveTweens.Num() - 1; Index >= 0; --Index)
         {
-            SendErrorResponse(OnComplete, TEXT("Invalid path"));
-            return true;
+            const FActorTween& Tween = ActiveTweens[Index];
+            if (Tween.Property == Property && Tween.Actor.Get() == Actor)
+            {
+                ActiveTweens.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+            }
         }
+    }
 
-        FString ActorName = PathParts[1];
-        
-        TSharedPtr<FJsonObject> JsonBody = ParseJsonBody(Request);
-        if (!JsonBody.IsValid())
+    // "duration"が指定されていれば補間を開始する。即時反映すべき場合はfalseを返す
+    bool TryStartTween(AActor* Actor, ETweenProperty Property, const FVector4& Target, const TSharedPtr<FJsonObject>& JsonBody)
+    {
+        // 同じプロパティの補間は新しい指示で置き換える
+        CancelTween(Actor, Property);
+
+        double Duration = 0.0;
+        if (!JsonBody->TryGetNumberField(TEXT("duration"), Duration) || Duration <= 0.0)
         {
-            SendErrorResponse(OnComplete, TEXT("Invalid JSON"));
-            return true;
+            return false;
         }
 
-        TSharedPtr<FJsonObject> RotationObj = JsonBody->GetObjectField(TEXT("rotation"));
-        FRotator NewRotation(
-            RotationObj->GetNumberField(TEXT("pitch")),
-            RotationObj->GetNumberField(TEXT("yaw")),
-            RotationObj->GetNumberField(TEXT("roll"))
-        );
+        FActorTween& Tween = ActiveTweens.AddDefaulted_GetRef();
+        Tween.Actor = Actor;
+        Tween.Property = Property;
+        Tween.StartTime = FPlatformTime::Seconds();
+        Tween.Duration = Duration;
+        Tween.From = GetTweenValue(Actor, Property);
 
-        AActor* FoundActor = FindActorByName(ActorName);
-        
-        if (FoundActor)
+        FString EasingName;
+        if (JsonBody->TryGetStringField(TEXT("easing"), EasingName))
         {
-            FoundActor->SetActorRotation(NewRotation);
-            
-            UE_LOG(LogTemp, Warning, TEXT("Rotated actor: %s to rotation (Pitch: %f, Yaw: %f, Roll: %f)"), 
-                *ActorName, NewRotation.Pitch, NewRotation.Yaw, NewRotation.Roll);
-            
-            TSharedPtr<FJsonObject> ResponseJson = MakeShareable(new FJsonObject);
-            ResponseJson->SetStringField(TEXT("status"), TEXT("success"));
-            SendJsonResponse(OnComplete, ResponseJson);
+            Tween.Easing = ParseEasing(EasingName);
         }
-        else
+
+        // キーフレーム経路（オプション）。終点はリクエスト本体の値
+        const TArray<TSharedPtr<FJsonValue>>* PathArray = nullptr;
+        if (JsonBody->TryGetArrayField(TEXT("path"), PathArray))
         {
-            SendErrorResponse(OnComplete, TEXT("Actor not found"), 404);
+            Tween.Keyframes.Reserve(PathArray->Num() + 1);
+            for (const TSharedPtr<FJsonValue>& PointValue : *PathArray)
+            {
+                TSharedPtr<FJsonObject> PointObj = PointValue->AsObject();
+                if (PointObj.IsValid())
+                {
+                    Tween.Keyframes.Add(ReadTweenValue(Property, PointObj));
+                }
+            }
         }
+        Tween.Keyframes.Add(Target);
 
+        UE_LOG(LogTemp, Warning, TEXT("Started tween on actor: %s (%.2fs, %d keyframes)"),
+            *Actor->GetActorLabel(), Duration, Tween.Keyframes.Num());
         return true;
     }
 
-    bool HandleGetSceneInfo(const FHttpServerRequest& Request, const FHttpResultCallback& OnComplete)
+    // 全ての補間を1回のループで進める
+    bool TickTweens(float DeltaTime)
     {
-        UWorld* World = GetGameWorld();
-        if (!World)
+        if (ActiveTweens.Num() == 0)
         {
-            SendErrorResponse(OnComplete, TEXT("No active world"));
             return true;
         }
 
-        TSharedPtr<FJsonObject> SceneJson = MakeShareable(new FJsonObject);
-        TArray<TSharedPtr<FJsonValue>> ActorsArray;
+        const double Now = FPlatformTime::Seconds();
 
-        for (TActorIterator<AActor> ActorItr(World); ActorItr; ++ActorItr)
+        // 末尾から走査し、完了した補間はRemoveAtSwapで詰める
+        for (int32 Index = ActiveTweens.Num() - 1; Index >= 0; --Index)
         {
-            AActor* Actor = *ActorItr;
-            
-            if (Actor->IsA<AWorldSettings>() || Actor->GetActorLabel().IsEmpty())
+            FActorTween& Tween = ActiveTweens[Index];
+            AActor* Actor = Tween.Actor.Get();
+            if (!Actor)
+            {
+                ActiveTweens.RemoveAtSwap(Index, 1, EAllowShrinking::No);
                 continue;
-            
-            TSharedPtr<FJsonObject> ActorJson = MakeShareable(new FJsonObject);
-            ActorJson->SetStringField(TEXT("name"), Actor->GetActorLabel());
-            ActorJson->SetStringField(TEXT("class"), Actor->GetClass()->GetName());
-            
-            FVector Location = Actor->GetActorLocation();
-            TSharedPtr<FJsonObject> LocationJson = MakeShareable(new FJsonObject);
-            LocationJson->SetNumberField(TEXT("x"), Location.X);
-            LocationJson->SetNumberField(TEXT("y"), Location.Y);
-            LocationJson->SetNumberField(TEXT("z"), Location.Z);
-            ActorJson->SetObjectField(TEXT("location"), LocationJson);
-            
-            FRotator Rotation = Actor->GetActorRotation();
-            TSharedPtr<FJsonObject> RotationJson = MakeShareable(new FJsonObject);
-            RotationJson->SetNumberField(TEXT("pitch"), Rotation.Pitch);
-            RotationJson->SetNumberField(TEXT("yaw"), Rotation.Yaw);
-            RotationJson->SetNumberField(TEXT("roll"), Rotation.Roll);
-            ActorJson->SetObjectField(TEXT("rotation"), RotationJson);
-            
-            FVector Scale = Actor->GetActorScale3D();
-            TSharedPtr<FJsonObject> ScaleJson = MakeShareable(new FJsonObject);
-            ScaleJson->SetNumberField(TEXT("x"), Scale.X);
-            ScaleJson->SetNumberField(TEXT("y"), Scale.Y);
-            ScaleJson->SetNumberField(TEXT("z"), Scale.Z);
-            ActorJson->SetObjectField(TEXT("scale"), ScaleJson);
-            
-            ActorsArray.Add(MakeShareable(new FJsonValueObject(ActorJson)));
-        }
+            }
 
-        SceneJson->SetArrayField(TEXT("actors"), ActorsArray);
-        SceneJson->SetNumberField(TEXT("actorCount"), ActorsArray.Num());
+            const double Alpha = FMath::Clamp((Now - Tween.StartTime) / Tween.Duration, 0.0, 1.0);
+            ApplyTweenValue(Actor, Tween.Property, EvaluateTween(Tween, ApplyEasing(Tween.Easing, Alpha)));
 
-        UE_LOG(LogTemp, Warning, TEXT("Retrieved scene info with %d actors"), ActorsArray.Num());
+            if (Alpha >= 1.0)
+            {
+                ActiveTweens.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+            }
+        }
 
-        SendJsonResponse(OnComplete, SceneJson);
         return true;
     }
 
-    UWorld* GetGameWorld()
+    void SendTweenStartedResponse(const FHttpResultCallback& OnComplete, const TSharedPtr<FJsonObject>& JsonBody)
+    {
+        FJsonResponseWriter Writer;
+        Writer.BeginObject();
+        Writer.StringField("status", TEXT("success"));
+        Writer.NumberField("duration", JsonBody->GetNumberField(TEXT("duration")));
+        Writer.EndObject();
+        SendJsonResponse(OnComplete, Writer);
+    }
+
+    // ルーターが抽出済みのパスパラメータを参照する（パスの再分割や文字列のコピーをしない）
+    static const FString* FindRouteParam(const FHttpServerRequest& Request, const TCHAR* Name)
     {
-        if (GEngine)
+        for (const TPair<FString, FString>& Param : Request.PathParams)
         {
-            for (const FWorldContext& Context : GEngine->GetWorldContexts())
+            if (Param.Key == Name)
             {
-                if (Context.World() && Context.WorldType == EWorldType::PIE)
-                {
-                    return Context.World();
-                }
+                return &Param.Value;
             }
         }
-        
-#if WITH_EDITOR
-        if (GEditor)
+        return nullptr;
+    }
+
+    // 数値などの型付きパスパラメータ
+    template <typename T>
+    static bool TryGetRouteParam(const FHttpServerRequest& Request, const TCHAR* Name, T& OutValue)
+    {
+        const FString* Value = FindRouteParam(Request, Name);
+        return Value && LexTryParseString(OutValue, **Value);
+    }
+
+    UWorld* GetGameWorld()
+    {
+        if (CurrentWorld)
         {
-            return GEditor->GetEditorWorldContext().World();
+            return CurrentWorld;
         }
-#endif
-        
-        return nullptr;
+
+        // 既定はPIEの最初のワールド、無ければエディターのワールド
+        RefreshTargetWorlds();
+
+        UWorld* EditorWorld = nullptr;
+        for (const FTargetWorld& Target : TargetWorlds)
+        {
+            UWorld* World = Target.World.Get();
+            if (World && Target.WorldType == EWorldType::PIE)
+            {
+                return World;
+            }
+            if (World && Target.WorldType == EWorldType::Editor && !EditorWorld)
+            {
+                EditorWorld = World;
+            }
+        }
+
+        return EditorWorld;
     }
 
     AActor* FindActorByName(const FString& ActorName)
@@ -862,11 +3296,18 @@ private:
                 return *ActorItr;
             }
         }
-        return nullptr;
+
+        // 作成APIが返すactorId（オブジェクト名）でも引けるようにする
+        return FindObject<AActor>(World->PersistentLevel, *ActorName);
     }
 
     TSharedPtr<FJsonObject> ParseJsonBody(const FHttpServerRequest& Request)
     {
+        if (PreparsedBody.IsValid())
+        {
+            return PreparsedBody;
+        }
+
         FString JsonString;
         if (Request.Body.Num() > 0)
         {
@@ -879,27 +3320,44 @@ private:
         return JsonObject;
     }
 
-    void SendJsonResponse(const FHttpResultCallback& OnComplete, TSharedPtr<FJsonObject> JsonObject)
+    // 書き出したUTF-8バイト列をコピーせずにレスポンス本体へ移す
+    void SendJsonResponse(const FHttpResultCallback& OnComplete, FJsonResponseWriter& Writer, int32 StatusCode = 200)
     {
-        FString ResponseString;
-        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResponseString);
-        FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
-        
-        auto Response = FHttpServerResponse::Create(ResponseString, TEXT("application/json"));
-        OnComplete(MoveTemp(Response));
+        OnComplete(CreateJsonResponse(Writer.Finish(), StatusCode));
     }
 
-    void SendErrorResponse(const FHttpResultCallback& OnComplete, const FString& ErrorMessage, int32 StatusCode = 400)
+    // 固定の本体は事前エンコード済みのバイト列をそのまま使う
+    template <int32 N>
+    void SendPreencodedResponse(const FHttpResultCallback& OnComplete, const ANSICHAR (&Body)[N])
     {
-        TSharedPtr<FJsonObject> ErrorJson = MakeShareable(new FJsonObject);
-        ErrorJson->SetStringField(TEXT("error"), ErrorMessage);
-        
-        FString ResponseString;
-        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ResponseString);
-        FJsonSerializer::Serialize(ErrorJson.ToSharedRef(), Writer);
-        
-        auto Response = FHttpServerResponse::Create(ResponseString, TEXT("application/json"));
+        OnComplete(CreateJsonResponse(TArray<uint8>(reinterpret_cast<const uint8*>(Body), N - 1), 200));
+    }
+
+    static TUniquePtr<FHttpServerResponse> CreateJsonResponse(TArray<uint8>&& Body, int32 StatusCode)
+    {
+        auto Response = FHttpServerResponse::Create(MoveTemp(Body), TEXT("application/json"));
         Response->Code = static_cast<EHttpServerResponseCodes>(StatusCode);
+        return Response;
+    }
+
+    TUniquePtr<FHttpServerResponse> CreateErrorResponse(const FString& ErrorMessage, int32 StatusCode)
+    {
+        FJsonResponseWriter Writer(32 + ErrorMessage.Len());
+        Writer.BeginObject();
+        Writer.StringField("error", ErrorMessage);
+        Writer.EndObject();
+        return CreateJsonResponse(Writer.Finish(), StatusCode);
+    }
+
+    void SendErrorResponse(const FHttpResultCallback& OnComplete, const FString& ErrorMessage, int32 StatusCode = 400)
+    {
+        OnComplete(CreateErrorResponse(ErrorMessage, StatusCode));
+    }
+
+    void SendTooManyRequestsResponse(const FHttpResultCallback& OnComplete)
+    {
+        auto Response = CreateErrorResponse(TEXT("Server busy"), 429);
+        Response->Headers.Add(TEXT("Retry-After"), { FString::FromInt(CVarRetryAfterSeconds.GetValueOnGameThread()) });
         OnComplete(MoveTemp(Response));
     }
 };
\ No newline at end of file
@@ -0,0 +1,36 @@
+// Private/UE5HTTPServerSettings.cpp
+
+#include "UE5HTTPServerSettings.h"
+
+// 受付制御の設定（DefaultEngine.iniの[ConsoleVariables]やコンソールから変更可能）
+TAutoConsoleVariable<int32> CVarMaxQueuedPerRoute(
+    TEXT("UE5HTTPServer.MaxQueuedPerRoute"), 256,
+    TEXT("ルートごとの待ち行列の上限。超えたリクエストは429を返す"));
+
+TAutoConsoleVariable<int32> CVarMaxQueuedPerClient(
+    TEXT("UE5HTTPServer.MaxQueuedPerClient"), 64,
+    TEXT("クライアントごとの待ち行列の上限。超えたリクエストは429を返す"));
+
+TAutoConsoleVariable<float> CVarFrameBudgetMs(
+    TEXT("UE5HTTPServer.FrameBudgetMs"), 8.0f,
+    TEXT("1フレームでリクエスト処理に使う時間の上限（ミリ秒）"));
+
+TAutoConsoleVariable<int32> CVarFloatPrecision(
+    TEXT("UE5HTTPServer.FloatPrecision"), -1,
+    TEXT("レスポンスの小数点以下の桁数（0〜9）。負の値は有効数字17桁（/sceneは?precision=で上書き可能）"));
+
+TAutoConsoleVariable<FString> CVarLocalSocketPath(
+    TEXT("UE5HTTPServer.LocalSocketPath"), TEXT(""),
+    TEXT("同一ホスト向けローカル転送のUnixドメインソケットのパス。空なら無効（起動時に読む）"));
+
+TAutoConsoleVariable<int32> CVarRetryAfterSeconds(
+    TEXT("UE5HTTPServer.RetryAfterSeconds"), 1,
+    TEXT("429応答のRetry-Afterヘッダーに入れる秒数"));
+
+TAutoConsoleVariable<float> CVarImportBudgetMs(
+    TEXT("UE5HTTPServer.ImportBudgetMs"), 4.0f,
+    TEXT("1フレームでインポートのアクター作成に使う時間の上限（ミリ秒）"));
+
+TAutoConsoleVariable<int32> CVarImportMaxPendingRecords(
+    TEXT("UE5HTTPServer.ImportMaxPendingRecords"), 16384,
+    TEXT("アップロード中のインポートで未作成のまま保持するレコード数の上限。超えたチャンクは429を返す"));
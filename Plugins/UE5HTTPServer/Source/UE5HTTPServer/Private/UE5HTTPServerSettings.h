@@ -0,0 +1,17 @@
+// Private/UE5HTTPServerSettings.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+
+// サーバーの設定用コンソール変数
+// UE5HTTPServer.cppはUE5HTTPServerModule.cppにもインクルードされるため、同じ名前の登録が二重にならないよう定義はUE5HTTPServerSettings.cppにだけ置く
+extern TAutoConsoleVariable<int32> CVarMaxQueuedPerRoute;
+extern TAutoConsoleVariable<int32> CVarMaxQueuedPerClient;
+extern TAutoConsoleVariable<float> CVarFrameBudgetMs;
+extern TAutoConsoleVariable<int32> CVarFloatPrecision;
+extern TAutoConsoleVariable<FString> CVarLocalSocketPath;
+extern TAutoConsoleVariable<int32> CVarRetryAfterSeconds;
+extern TAutoConsoleVariable<float> CVarImportBudgetMs;
+extern TAutoConsoleVariable<int32> CVarImportMaxPendingRecords;
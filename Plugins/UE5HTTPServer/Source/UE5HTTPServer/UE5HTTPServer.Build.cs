@@ -33,7 +33,8 @@ public class UE5HTTPServer : ModuleRules
             new string[]
             {
                 "Slate",
-                "SlateCore"
+                "SlateCore",
+                "Sockets"
             }
         );
         